@@ -0,0 +1,415 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_omp_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_DruckerPrager_01.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "DruckerPrager_01.in" "s")
+set_tests_properties(test_DruckerPrager_01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_Mises01.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "Mises01.in" "s")
+set_tests_properties(test_Mises01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_axisymm01.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "axisymm01.in" "s")
+set_tests_properties(test_axisymm01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_axisymm02.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "axisymm02.in" "s")
+set_tests_properties(test_axisymm02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_axisymm03.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "axisymm03.in" "s")
+set_tests_properties(test_axisymm03.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_axisymm04.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "axisymm04.in" "s")
+set_tests_properties(test_axisymm04.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_axisymm05.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "axisymm05.in" "s")
+set_tests_properties(test_axisymm05.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_axisymm06.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "axisymm06.in" "s")
+set_tests_properties(test_axisymm06.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_beam2d_1.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "beam2d_1.in" "s")
+set_tests_properties(test_beam2d_1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_beam2d_2.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "beam2d_2.in" "s")
+set_tests_properties(test_beam2d_2.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_beam2d_3.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "beam2d_3.in" "s")
+set_tests_properties(test_beam2d_3.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_beam2d_4.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "beam2d_4.in" "s")
+set_tests_properties(test_beam2d_4.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_beam3d_1.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "beam3d_1.in" "s")
+set_tests_properties(test_beam3d_1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_beam3d_2.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "beam3d_2.in" "s")
+set_tests_properties(test_beam3d_2.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_beam44.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "beam44.in" "s")
+set_tests_properties(test_beam44.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_brick_nlgeo_1.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "brick_nlgeo_1.in" "s")
+set_tests_properties(test_brick_nlgeo_1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_brick_nlgeo_2.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "brick_nlgeo_2.in" "s")
+set_tests_properties(test_brick_nlgeo_2.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_brick_nlgeo_3.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "brick_nlgeo_3.in" "s")
+set_tests_properties(test_brick_nlgeo_3.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_brick_nlgeo_4.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "brick_nlgeo_4.in" "s")
+set_tests_properties(test_brick_nlgeo_4.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_brick_nlgeo_5.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "brick_nlgeo_5.in" "s")
+set_tests_properties(test_brick_nlgeo_5.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_brick_nlgeo_6.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "brick_nlgeo_6.in" "s")
+set_tests_properties(test_brick_nlgeo_6.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_brick_nlgeo_7.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "brick_nlgeo_7.in" "s")
+set_tests_properties(test_brick_nlgeo_7.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_brick_nlgeo_cache.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "brick_nlgeo_cache.in" "s")
+set_tests_properties(test_brick_nlgeo_cache.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_cantilever_Qspace.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "cantilever_Qspace.in" "s")
+set_tests_properties(test_cantilever_Qspace.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_compoDamMat.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "compoDamMat.in" "s")
+set_tests_properties(test_compoDamMat.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_con2dpm.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "con2dpm.in" "s")
+set_tests_properties(test_con2dpm.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_con2dpm2.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "con2dpm2.in" "s")
+set_tests_properties(test_con2dpm2.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_control_switch_1.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "control_switch_1.in" "s")
+set_tests_properties(test_control_switch_1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_control_switch_2.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "control_switch_2.in" "s")
+set_tests_properties(test_control_switch_2.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_deactivate_1.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "deactivate_1.in" "s")
+set_tests_properties(test_deactivate_1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_deactivate_2.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "deactivate_2.in" "s")
+set_tests_properties(test_deactivate_2.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_deadweight01.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "deadweight01.in" "s")
+set_tests_properties(test_deadweight01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_eigen_beam2d.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "eigen_beam2d.in" "s")
+set_tests_properties(test_eigen_beam2d.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_eigen_beam3d.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "eigen_beam3d.in" "s")
+set_tests_properties(test_eigen_beam3d.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_eigen_brick3d.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "eigen_brick3d.in" "s")
+set_tests_properties(test_eigen_brick3d.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_eigenstrain01.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "eigenstrain01.in" "s")
+set_tests_properties(test_eigenstrain01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_eigenstrain02.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "eigenstrain02.in" "s")
+set_tests_properties(test_eigenstrain02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_ex-bspline-01.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "ex-bspline-01.in" "s")
+set_tests_properties(test_ex-bspline-01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_ex-bspline-02.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "ex-bspline-02.in" "s")
+set_tests_properties(test_ex-bspline-02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_ex-bspline-03.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "ex-bspline-03.in" "s")
+set_tests_properties(test_ex-bspline-03.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_ex-bspline-04.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "ex-bspline-04.in" "s")
+set_tests_properties(test_ex-bspline-04.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_ex-bspline-05.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "ex-bspline-05.in" "s")
+set_tests_properties(test_ex-bspline-05.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_ex-bspline-06.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "ex-bspline-06.in" "s")
+set_tests_properties(test_ex-bspline-06.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_ex-bspline-07.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "ex-bspline-07.in" "s")
+set_tests_properties(test_ex-bspline-07.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_ex-bspline-08.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "ex-bspline-08.in" "s")
+set_tests_properties(test_ex-bspline-08.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_ex-bspline-09.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "ex-bspline-09.in" "s")
+set_tests_properties(test_ex-bspline-09.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_ex3d-nurbs-01.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "ex3d-nurbs-01.in" "s")
+set_tests_properties(test_ex3d-nurbs-01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_ex3d-nurbs-02.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "ex3d-nurbs-02.in" "s")
+set_tests_properties(test_ex3d-nurbs-02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_ex3d-nurbs-03.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "ex3d-nurbs-03.in" "s")
+set_tests_properties(test_ex3d-nurbs-03.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_hangingnode01.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "hangingnode01.in" "s")
+set_tests_properties(test_hangingnode01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_hangingnode02.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "hangingnode02.in" "s")
+set_tests_properties(test_hangingnode02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_hangingnode03.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "hangingnode03.in" "s")
+set_tests_properties(test_hangingnode03.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_homog01.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "homog01.in" "s")
+set_tests_properties(test_homog01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_homog02.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "homog02.in" "s")
+set_tests_properties(test_homog02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_idm01.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "idm01.in" "s")
+set_tests_properties(test_idm01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_idm02.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "idm02.in" "s")
+set_tests_properties(test_idm02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_idm03.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "idm03.in" "s")
+set_tests_properties(test_idm03.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_idm04.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "idm04.in" "s")
+set_tests_properties(test_idm04.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_idm05.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "idm05.in" "s")
+set_tests_properties(test_idm05.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_idm06.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "idm06.in" "s")
+set_tests_properties(test_idm06.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_idm07.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "idm07.in" "s")
+set_tests_properties(test_idm07.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_idm08.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "idm08.in" "s")
+set_tests_properties(test_idm08.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_idmnl01.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "idmnl01.in" "s")
+set_tests_properties(test_idmnl01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_idmnl01_fused.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "idmnl01_fused.in" "s")
+set_tests_properties(test_idmnl01_fused.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_incrlinstatic_isimposed.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "incrlinstatic_isimposed.in" "s")
+set_tests_properties(test_incrlinstatic_isimposed.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_interface01.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "interface01.in" "s")
+set_tests_properties(test_interface01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_interface3d.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "interface3d.in" "s")
+set_tests_properties(test_interface3d.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_layered_libeam2d.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "layered_libeam2d.in" "s")
+set_tests_properties(test_layered_libeam2d.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_libean3dnl.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "libean3dnl.in" "s")
+set_tests_properties(test_libean3dnl.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_linear_constraint_1.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "linear_constraint_1.in" "s")
+set_tests_properties(test_linear_constraint_1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_linear_constraint_2.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "linear_constraint_2.in" "s")
+set_tests_properties(test_linear_constraint_2.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_linear_constraint_3.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "linear_constraint_3.in" "s")
+set_tests_properties(test_linear_constraint_3.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_linstab_beam2d.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "linstab_beam2d.in" "s")
+set_tests_properties(test_linstab_beam2d.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_macroLspace01.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "macroLspace01.in" "s")
+set_tests_properties(test_macroLspace01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_materOrient01.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "materOrient01.in" "s")
+set_tests_properties(test_materOrient01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_microplane_m4.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "microplane_m4.in" "s")
+set_tests_properties(test_microplane_m4.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_nldeidynamic01.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "nldeidynamic01.in" "s")
+set_tests_properties(test_nldeidynamic01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_nldeidynamic02.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "nldeidynamic02.in" "s")
+set_tests_properties(test_nldeidynamic02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_nldeidynamic03.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "nldeidynamic03.in" "s")
+set_tests_properties(test_nldeidynamic03.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_patch010.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "patch010.in" "s")
+set_tests_properties(test_patch010.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_patch011.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "patch011.in" "s")
+set_tests_properties(test_patch011.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_patch100.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "patch100.in" "s")
+set_tests_properties(test_patch100.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_patch101.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "patch101.in" "s")
+set_tests_properties(test_patch101.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_patch102.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "patch102.in" "s")
+set_tests_properties(test_patch102.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_patch103.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "patch103.in" "s")
+set_tests_properties(test_patch103.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_patch104.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "patch104.in" "s")
+set_tests_properties(test_patch104.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_patch105.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "patch105.in" "s")
+set_tests_properties(test_patch105.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_patch106.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "patch106.in" "s")
+set_tests_properties(test_patch106.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_patch107.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "patch107.in" "s")
+set_tests_properties(test_patch107.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_patch108.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "patch108.in" "s")
+set_tests_properties(test_patch108.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_patch110.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "patch110.in" "s")
+set_tests_properties(test_patch110.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_patch130.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "patch130.in" "s")
+set_tests_properties(test_patch130.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_patch140.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "patch140.in" "s")
+set_tests_properties(test_patch140.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_patch150.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "patch150.in" "s")
+set_tests_properties(test_patch150.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_patch160.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "patch160.in" "s")
+set_tests_properties(test_patch160.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_patch200.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "patch200.in" "s")
+set_tests_properties(test_patch200.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_patch300.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "patch300.in" "s")
+set_tests_properties(test_patch300.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_patch301.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "patch301.in" "s")
+set_tests_properties(test_patch301.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_patch302.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "patch302.in" "s")
+set_tests_properties(test_patch302.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_planestress_j2.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "planestress_j2.in" "s")
+set_tests_properties(test_planestress_j2.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_planestress_j2_frozen.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "planestress_j2_frozen.in" "s")
+set_tests_properties(test_planestress_j2_frozen.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_recoverycache01.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "recoverycache01.in" "s")
+set_tests_properties(test_recoverycache01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_rigarm01.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "rigarm01.in" "s")
+set_tests_properties(test_rigarm01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_rigarm02.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "rigarm02.in" "s")
+set_tests_properties(test_rigarm02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_rigarm03.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "rigarm03.in" "s")
+set_tests_properties(test_rigarm03.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_rigarm04.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "rigarm04.in" "s")
+set_tests_properties(test_rigarm04.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_rotated_1.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "rotated_1.in" "s")
+set_tests_properties(test_rotated_1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_rotated_2.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "rotated_2.in" "s")
+set_tests_properties(test_rotated_2.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_slavedofs.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "slavedofs.in" "s")
+set_tests_properties(test_slavedofs.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_spring01.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "spring01.in" "s")
+set_tests_properties(test_spring01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_spring02.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "spring02.in" "s")
+set_tests_properties(test_spring02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_spring03.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "spring03.in" "s")
+set_tests_properties(test_spring03.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_spring04.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "spring04.in" "s")
+set_tests_properties(test_spring04.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_spring05.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "spring05.in" "s")
+set_tests_properties(test_spring05.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_spring06.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "spring06.in" "s")
+set_tests_properties(test_spring06.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_statusarena01.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "statusarena01.in" "s")
+set_tests_properties(test_statusarena01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_trussb3_creep.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "trussb3_creep.in" "s")
+set_tests_properties(test_trussb3_creep.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_trussb3_relax.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "trussb3_relax.in" "s")
+set_tests_properties(test_trussb3_relax.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_vtkxmlbinary01.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "vtkxmlbinary01.in" "s")
+set_tests_properties(test_vtkxmlbinary01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_xFemCrackVal.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "xFemCrackVal.in" "s")
+set_tests_properties(test_xFemCrackVal.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_xFemCrackValBranch.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "xFemCrackValBranch.in" "s")
+set_tests_properties(test_xFemCrackValBranch.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_xFemNarrowBand.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "xFemNarrowBand.in" "s")
+set_tests_properties(test_xFemNarrowBand.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;655;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_fe2fluid01.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "fe2fluid01.in" "s")
+set_tests_properties(test_fe2fluid01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//fm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;663;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_patch02.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "patch02.in" "s")
+set_tests_properties(test_patch02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//fm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;663;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_patch03.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "patch03.in" "s")
+set_tests_properties(test_patch03.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//fm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;663;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_patch05.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "patch05.in" "s")
+set_tests_properties(test_patch05.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//fm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;663;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_simpleDarcy.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "simpleDarcy.in" "s")
+set_tests_properties(test_simpleDarcy.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//fm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;663;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_simpleNonlinearDarcy.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "simpleNonlinearDarcy.in" "s")
+set_tests_properties(test_simpleNonlinearDarcy.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//fm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;663;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_simpleNonlinearStokes.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "simpleNonlinearStokes.in" "s")
+set_tests_properties(test_simpleNonlinearStokes.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//fm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;663;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_weakPeriodicTriangularObstacle.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "weakPeriodicTriangularObstacle.in" "s")
+set_tests_properties(test_weakPeriodicTriangularObstacle.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//fm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;663;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_TwoStepCasting_01.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "TwoStepCasting_01.in" "s")
+set_tests_properties(test_TwoStepCasting_01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_bazantnajjar.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "bazantnajjar.in" "s")
+set_tests_properties(test_bazantnajjar.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_cemhyd01.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "cemhyd01.in" "s")
+set_tests_properties(test_cemhyd01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_cemhyd02.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "cemhyd02.in" "s")
+set_tests_properties(test_cemhyd02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_hydratingConcreteMat01.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "hydratingConcreteMat01.in" "s")
+set_tests_properties(test_hydratingConcreteMat01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_hydratingConcreteMat02.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "hydratingConcreteMat02.in" "s")
+set_tests_properties(test_hydratingConcreteMat02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_hydratingConcreteMat03.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "hydratingConcreteMat03.in" "s")
+set_tests_properties(test_hydratingConcreteMat03.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_hydratingConcreteMat04.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "hydratingConcreteMat04.in" "s")
+set_tests_properties(test_hydratingConcreteMat04.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_isolinmoisture.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "isolinmoisture.in" "s")
+set_tests_properties(test_isolinmoisture.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_nlisomoisture.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "nlisomoisture.in" "s")
+set_tests_properties(test_nlisomoisture.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_qbrick_01.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "qbrick_01.in" "s")
+set_tests_properties(test_qbrick_01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_qbrick_02.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "qbrick_02.in" "s")
+set_tests_properties(test_qbrick_02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_qbrick_03.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "qbrick_03.in" "s")
+set_tests_properties(test_qbrick_03.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_quadaxisym01.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "quadaxisym01.in" "s")
+set_tests_properties(test_quadaxisym01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_quadaxisym02.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "quadaxisym02.in" "s")
+set_tests_properties(test_quadaxisym02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_quadaxisym03.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "quadaxisym03.in" "s")
+set_tests_properties(test_quadaxisym03.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_simpleMultiscaleDarcy.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "simpleMultiscaleDarcy.in" "s")
+set_tests_properties(test_simpleMultiscaleDarcy.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmpatch01.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "tmpatch01.in" "s")
+set_tests_properties(test_tmpatch01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmpatch02.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "tmpatch02.in" "s")
+set_tests_properties(test_tmpatch02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmpatch03.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "tmpatch03.in" "s")
+set_tests_properties(test_tmpatch03.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmpatch04.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "tmpatch04.in" "s")
+set_tests_properties(test_tmpatch04.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmpatch05.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "tmpatch05.in" "s")
+set_tests_properties(test_tmpatch05.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmpatch06.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "tmpatch06.in" "s")
+set_tests_properties(test_tmpatch06.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmpatch07-8.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "tmpatch07-8.in" "s")
+set_tests_properties(test_tmpatch07-8.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmpatch08-8.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "tmpatch08-8.in" "s")
+set_tests_properties(test_tmpatch08-8.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmpatch11.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "tmpatch11.in" "s")
+set_tests_properties(test_tmpatch11.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmpatch11dtf.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "tmpatch11dtf.in" "s")
+set_tests_properties(test_tmpatch11dtf.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmpatch15.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "tmpatch15.in" "s")
+set_tests_properties(test_tmpatch15.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmpatch20-8.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "tmpatch20-8.in" "s")
+set_tests_properties(test_tmpatch20-8.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmpatch21-8.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "tmpatch21-8.in" "s")
+set_tests_properties(test_tmpatch21-8.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmpatch31.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "tmpatch31.in" "s")
+set_tests_properties(test_tmpatch31.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmpatch32.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "tmpatch32.in" "s")
+set_tests_properties(test_tmpatch32.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmpatch33.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "tmpatch33.in" "s")
+set_tests_properties(test_tmpatch33.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmpatch34.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "tmpatch34.in" "s")
+set_tests_properties(test_tmpatch34.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmpatch35.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "tmpatch35.in" "s")
+set_tests_properties(test_tmpatch35.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmpatch36.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "tmpatch36.in" "s")
+set_tests_properties(test_tmpatch36.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmpatch37.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "tmpatch37.in" "s")
+set_tests_properties(test_tmpatch37.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmpatch38.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "tmpatch38.in" "s")
+set_tests_properties(test_tmpatch38.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmpatch40.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "tmpatch40.in" "s")
+set_tests_properties(test_tmpatch40.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmpatch41.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "tmpatch41.in" "s")
+set_tests_properties(test_tmpatch41.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmpatch42.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "tmpatch42.in" "s")
+set_tests_properties(test_tmpatch42.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmpatch43-1.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "tmpatch43-1.in" "s")
+set_tests_properties(test_tmpatch43-1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmpatch43-2.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "tmpatch43-2.in" "s")
+set_tests_properties(test_tmpatch43-2.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmpatch43-3.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "tmpatch43-3.in" "s")
+set_tests_properties(test_tmpatch43-3.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmpatch44-1.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "tmpatch44-1.in" "s")
+set_tests_properties(test_tmpatch44-1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmpatch44-2.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "tmpatch44-2.in" "s")
+set_tests_properties(test_tmpatch44-2.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmpatch44-3.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "tmpatch44-3.in" "s")
+set_tests_properties(test_tmpatch44-3.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmquad12.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "tmquad12.in" "s")
+set_tests_properties(test_tmquad12.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_tmquad12nl.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "tmquad12nl.in" "s")
+set_tests_properties(test_tmquad12nl.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;666;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_nltrans_incr.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "nltrans_incr.in" "s")
+set_tests_properties(test_nltrans_incr.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tmsm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;669;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_nltrans_nonlin.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "nltrans_nonlin.in" "s")
+set_tests_properties(test_nltrans_nonlin.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tmsm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;669;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_nonstat_nonlin_01.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "nonstat_nonlin_01.in" "s")
+set_tests_properties(test_nonstat_nonlin_01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tmsm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;669;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_nonstat_nonlin_02.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "nonstat_nonlin_02.in" "s")
+set_tests_properties(test_nonstat_nonlin_02.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tmsm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;669;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_xfemtemp01.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "xfemtemp01.in" "s")
+set_tests_properties(test_xfemtemp01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//tmsm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;669;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_dss_ldl01.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "dss_ldl01.in" "s")
+set_tests_properties(test_dss_ldl01.in PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=2" WORKING_DIRECTORY "/root/repo/tests//dss" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;675;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_dss_ll01.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "dss_ll01.in" "s")
+set_tests_properties(test_dss_ll01.in PROPERTIES  ENVIRONMENT "OMP_NUM_THREADS=2" WORKING_DIRECTORY "/root/repo/tests//dss" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;675;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(bintest_Mises01.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "Mises01.in" "b")
+set_tests_properties(bintest_Mises01.in PROPERTIES  DEPENDS "test_Mises01.in" WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;685;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(bintest_rotated_1.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "rotated_1.in" "b")
+set_tests_properties(bintest_rotated_1.in PROPERTIES  DEPENDS "test_rotated_1.in" WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;685;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(bintest_xFemCrackValBranch.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "xFemCrackValBranch.in" "b")
+set_tests_properties(bintest_xFemCrackValBranch.in PROPERTIES  DEPENDS "test_xFemCrackValBranch.in" WORKING_DIRECTORY "/root/repo/tests//sm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;685;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(bintest_bazantnajjar.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "bazantnajjar.in" "b")
+set_tests_properties(bintest_bazantnajjar.in PROPERTIES  DEPENDS "test_bazantnajjar.in" WORKING_DIRECTORY "/root/repo/tests//tm" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;685;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(benchmark_axi01.oofem.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "axi01.oofem.in" "s")
+set_tests_properties(benchmark_axi01.oofem.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//benchmark" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;692;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(benchmark_axi02.oofem.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "axi02.oofem.in" "s")
+set_tests_properties(benchmark_axi02.oofem.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//benchmark" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;692;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(benchmark_axi04.oofem.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "axi04.oofem.in" "s")
+set_tests_properties(benchmark_axi04.oofem.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//benchmark" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;692;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(benchmark_bdam7.oofem.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "bdam7.oofem.in" "s")
+set_tests_properties(benchmark_bdam7.oofem.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//benchmark" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;692;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(benchmark_concrete_3point.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "concrete_3point.in" "s")
+set_tests_properties(benchmark_concrete_3point.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//benchmark" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;692;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(benchmark_concrete_3point_direct.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "concrete_3point_direct.in" "s")
+set_tests_properties(benchmark_concrete_3point_direct.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//benchmark" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;692;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(benchmark_eigendyn_cct.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "eigendyn_cct.in" "s")
+set_tests_properties(benchmark_eigendyn_cct.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//benchmark" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;692;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(benchmark_j2mat.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "j2mat.in" "s")
+set_tests_properties(benchmark_j2mat.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//benchmark" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;692;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(benchmark_steel1.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "steel1.in" "s")
+set_tests_properties(benchmark_steel1.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//benchmark" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;692;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(benchmark_tr2shell7.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "tr2shell7.in" "s")
+set_tests_properties(benchmark_tr2shell7.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//benchmark" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;692;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(benchmark_tr2shell7XFEM.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "tr2shell7XFEM.in" "s")
+set_tests_properties(benchmark_tr2shell7XFEM.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//benchmark" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;692;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(benchmark_xfem01.in "/root/.pyenv/shims/python2.7" "/root/repo/_omp_build/testhelper.py" "/root/repo/_omp_build/oofem" "xfem01.in" "s")
+set_tests_properties(benchmark_xfem01.in PROPERTIES  WORKING_DIRECTORY "/root/repo/tests//benchmark" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;692;add_test;/root/repo/CMakeLists.txt;0;")
+subdirs("src/oofemlib")
+subdirs("src/dss")
+subdirs("src/sm")
+subdirs("src/tm")
+subdirs("src/fm")
@@ -0,0 +1,64 @@
+#define PRG_VERSION "OOFEM version 2.2"
+#define OOFEG_VERSION "OOFEG version 2.2"
+#define OOFEM_COPYRIGHT "Copyright (C) 1994-2013 Borek Patzak"
+
+#define PRG_HEADER_SM "\
+____________________________________________________\n\
+           OOFEM - Finite Element Solver            \n\
+        Copyright (C) 1994-2013 Borek Patzak        \n\
+____________________________________________________\n"
+
+#define PRG_HEADER "\
+############################################################## www.oofem.org ###\n\
+       ####    ####   ######  ######  #    #\n\
+     #    #  #    #  #       #       ##  ##\n\
+    #    #  #    #  #####   #####   # ## #\n\
+   #    #  #    #  #       #       #    #\n\
+  #    #  #    #  #       #       #    #   OOFEM ver. 2.2\n\
+  ####    ####   #       ######  #    #    Copyright (C) 1994-2013 Borek Patzak\n\
+################################################################################\n\n"
+
+#define HOST_TYPE "x86_64-Linux"
+#define HOST_NAME "vm"
+#define MODULE_LIST "fm;tm;sm;dss;openmp"
+
+/* Headers */
+/* Define if #include<sys/time.h> exist */
+#define HAVE_SYS_TIME_H 1
+
+/* Define if strings.h defined */
+#define HAVE_STRINGS_H 1
+
+/* Define if unistd.h defined */
+#define HAVE_UNISTD_H 1
+
+/* Define if execinfo.h defined */
+#define HAVE_EXECINFO_H 1
+
+/* Define if program may include both 'time.h' and 'sys/time.h' */
+#define TIME_WITH_SYS_TIME 1
+
+/* Symbols */
+/* Define if access is defined */
+#define HAVE_ACCESS 1
+
+/* Define if strncasecmp is defined */
+#define HAVE_STRNCASECMP 1
+
+/* Define if cbrt is defined */
+#define HAVE_CBRT 1
+
+/* Define if isnan is defined */
+/* #undef HAVE_ISNAN */
+
+/* Variables */
+/* Define if M_PI constant is defined */
+#define HAVE_M_PI 1
+
+/* Define if M_LN2 constant is defined */
+#define HAVE_M_LN2 1
+
+/* Other */
+/* Define if __VA_ARGS__ macro is supported by preprocessor */
+#define HAVE_MACRO_VA_ARGS 1
+
@@ -0,0 +1,35 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/dss/BiSection.cpp" "src/dss/CMakeFiles/dss.dir/BiSection.cpp.o" "gcc" "src/dss/CMakeFiles/dss.dir/BiSection.cpp.o.d"
+  "/root/repo/src/dss/BigMatrix.cpp" "src/dss/CMakeFiles/dss.dir/BigMatrix.cpp.o" "gcc" "src/dss/CMakeFiles/dss.dir/BigMatrix.cpp.o.d"
+  "/root/repo/src/dss/DSSolver.cpp" "src/dss/CMakeFiles/dss.dir/DSSolver.cpp.o" "gcc" "src/dss/CMakeFiles/dss.dir/DSSolver.cpp.o.d"
+  "/root/repo/src/dss/DenseMatrixArithmeticsNN.cpp" "src/dss/CMakeFiles/dss.dir/DenseMatrixArithmeticsNN.cpp.o" "gcc" "src/dss/CMakeFiles/dss.dir/DenseMatrixArithmeticsNN.cpp.o.d"
+  "/root/repo/src/dss/IntArrayList.cpp" "src/dss/CMakeFiles/dss.dir/IntArrayList.cpp.o" "gcc" "src/dss/CMakeFiles/dss.dir/IntArrayList.cpp.o.d"
+  "/root/repo/src/dss/MathTracer.cpp" "src/dss/CMakeFiles/dss.dir/MathTracer.cpp.o" "gcc" "src/dss/CMakeFiles/dss.dir/MathTracer.cpp.o.d"
+  "/root/repo/src/dss/SkyLineMtx.cpp" "src/dss/CMakeFiles/dss.dir/SkyLineMtx.cpp.o" "gcc" "src/dss/CMakeFiles/dss.dir/SkyLineMtx.cpp.o.d"
+  "/root/repo/src/dss/SkyLineMtxLDL.cpp" "src/dss/CMakeFiles/dss.dir/SkyLineMtxLDL.cpp.o" "gcc" "src/dss/CMakeFiles/dss.dir/SkyLineMtxLDL.cpp.o.d"
+  "/root/repo/src/dss/SparseConectivityMtx.cpp" "src/dss/CMakeFiles/dss.dir/SparseConectivityMtx.cpp.o" "gcc" "src/dss/CMakeFiles/dss.dir/SparseConectivityMtx.cpp.o.d"
+  "/root/repo/src/dss/SparseGridMtx.cpp" "src/dss/CMakeFiles/dss.dir/SparseGridMtx.cpp.o" "gcc" "src/dss/CMakeFiles/dss.dir/SparseGridMtx.cpp.o.d"
+  "/root/repo/src/dss/SparseGridMtxLDL.cpp" "src/dss/CMakeFiles/dss.dir/SparseGridMtxLDL.cpp.o" "gcc" "src/dss/CMakeFiles/dss.dir/SparseGridMtxLDL.cpp.o.d"
+  "/root/repo/src/dss/SparseGridMtxLL.cpp" "src/dss/CMakeFiles/dss.dir/SparseGridMtxLL.cpp.o" "gcc" "src/dss/CMakeFiles/dss.dir/SparseGridMtxLL.cpp.o.d"
+  "/root/repo/src/dss/SparseGridMtxLU.cpp" "src/dss/CMakeFiles/dss.dir/SparseGridMtxLU.cpp.o" "gcc" "src/dss/CMakeFiles/dss.dir/SparseGridMtxLU.cpp.o.d"
+  "/root/repo/src/dss/SparseGridMtxPD.cpp" "src/dss/CMakeFiles/dss.dir/SparseGridMtxPD.cpp.o" "gcc" "src/dss/CMakeFiles/dss.dir/SparseGridMtxPD.cpp.o.d"
+  "/root/repo/src/dss/SparseMatrixF.cpp" "src/dss/CMakeFiles/dss.dir/SparseMatrixF.cpp.o" "gcc" "src/dss/CMakeFiles/dss.dir/SparseMatrixF.cpp.o.d"
+  "/root/repo/src/dss/dssmatrix.C" "src/dss/CMakeFiles/dss.dir/dssmatrix.C.o" "gcc" "src/dss/CMakeFiles/dss.dir/dssmatrix.C.o.d"
+  "/root/repo/src/dss/dsssolver.C" "src/dss/CMakeFiles/dss.dir/dsssolver.C.o" "gcc" "src/dss/CMakeFiles/dss.dir/dsssolver.C.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
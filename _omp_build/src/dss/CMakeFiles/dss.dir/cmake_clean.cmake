@@ -0,0 +1,41 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dss.dir/BiSection.cpp.o"
+  "CMakeFiles/dss.dir/BiSection.cpp.o.d"
+  "CMakeFiles/dss.dir/BigMatrix.cpp.o"
+  "CMakeFiles/dss.dir/BigMatrix.cpp.o.d"
+  "CMakeFiles/dss.dir/DSSolver.cpp.o"
+  "CMakeFiles/dss.dir/DSSolver.cpp.o.d"
+  "CMakeFiles/dss.dir/DenseMatrixArithmeticsNN.cpp.o"
+  "CMakeFiles/dss.dir/DenseMatrixArithmeticsNN.cpp.o.d"
+  "CMakeFiles/dss.dir/IntArrayList.cpp.o"
+  "CMakeFiles/dss.dir/IntArrayList.cpp.o.d"
+  "CMakeFiles/dss.dir/MathTracer.cpp.o"
+  "CMakeFiles/dss.dir/MathTracer.cpp.o.d"
+  "CMakeFiles/dss.dir/SkyLineMtx.cpp.o"
+  "CMakeFiles/dss.dir/SkyLineMtx.cpp.o.d"
+  "CMakeFiles/dss.dir/SkyLineMtxLDL.cpp.o"
+  "CMakeFiles/dss.dir/SkyLineMtxLDL.cpp.o.d"
+  "CMakeFiles/dss.dir/SparseConectivityMtx.cpp.o"
+  "CMakeFiles/dss.dir/SparseConectivityMtx.cpp.o.d"
+  "CMakeFiles/dss.dir/SparseGridMtx.cpp.o"
+  "CMakeFiles/dss.dir/SparseGridMtx.cpp.o.d"
+  "CMakeFiles/dss.dir/SparseGridMtxLDL.cpp.o"
+  "CMakeFiles/dss.dir/SparseGridMtxLDL.cpp.o.d"
+  "CMakeFiles/dss.dir/SparseGridMtxLL.cpp.o"
+  "CMakeFiles/dss.dir/SparseGridMtxLL.cpp.o.d"
+  "CMakeFiles/dss.dir/SparseGridMtxLU.cpp.o"
+  "CMakeFiles/dss.dir/SparseGridMtxLU.cpp.o.d"
+  "CMakeFiles/dss.dir/SparseGridMtxPD.cpp.o"
+  "CMakeFiles/dss.dir/SparseGridMtxPD.cpp.o.d"
+  "CMakeFiles/dss.dir/SparseMatrixF.cpp.o"
+  "CMakeFiles/dss.dir/SparseMatrixF.cpp.o.d"
+  "CMakeFiles/dss.dir/dssmatrix.C.o"
+  "CMakeFiles/dss.dir/dssmatrix.C.o.d"
+  "CMakeFiles/dss.dir/dsssolver.C.o"
+  "CMakeFiles/dss.dir/dsssolver.C.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dss.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
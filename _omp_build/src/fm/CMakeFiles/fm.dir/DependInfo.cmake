@@ -0,0 +1,56 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/fm/binghamfluid2.C" "src/fm/CMakeFiles/fm.dir/binghamfluid2.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/binghamfluid2.C.o.d"
+  "/root/repo/src/fm/cbs.C" "src/fm/CMakeFiles/fm.dir/cbs.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/cbs.C.o.d"
+  "/root/repo/src/fm/cbselement.C" "src/fm/CMakeFiles/fm.dir/cbselement.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/cbselement.C.o.d"
+  "/root/repo/src/fm/fastmarchingmethod.C" "src/fm/CMakeFiles/fm.dir/fastmarchingmethod.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/fastmarchingmethod.C.o.d"
+  "/root/repo/src/fm/fe2fluidmaterial.C" "src/fm/CMakeFiles/fm.dir/fe2fluidmaterial.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/fe2fluidmaterial.C.o.d"
+  "/root/repo/src/fm/fluiddynamicmaterial.C" "src/fm/CMakeFiles/fm.dir/fluiddynamicmaterial.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/fluiddynamicmaterial.C.o.d"
+  "/root/repo/src/fm/fluidmaterialevaluator.C" "src/fm/CMakeFiles/fm.dir/fluidmaterialevaluator.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/fluidmaterialevaluator.C.o.d"
+  "/root/repo/src/fm/fluidmodel.C" "src/fm/CMakeFiles/fm.dir/fluidmodel.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/fluidmodel.C.o.d"
+  "/root/repo/src/fm/fmelement.C" "src/fm/CMakeFiles/fm.dir/fmelement.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/fmelement.C.o.d"
+  "/root/repo/src/fm/hexa1bubblestokes.C" "src/fm/CMakeFiles/fm.dir/hexa1bubblestokes.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/hexa1bubblestokes.C.o.d"
+  "/root/repo/src/fm/hexa21stokes.C" "src/fm/CMakeFiles/fm.dir/hexa21stokes.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/hexa21stokes.C.o.d"
+  "/root/repo/src/fm/leplic.C" "src/fm/CMakeFiles/fm.dir/leplic.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/leplic.C.o.d"
+  "/root/repo/src/fm/levelsetpcs.C" "src/fm/CMakeFiles/fm.dir/levelsetpcs.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/levelsetpcs.C.o.d"
+  "/root/repo/src/fm/line2boundaryelement.C" "src/fm/CMakeFiles/fm.dir/line2boundaryelement.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/line2boundaryelement.C.o.d"
+  "/root/repo/src/fm/line2surfacetension.C" "src/fm/CMakeFiles/fm.dir/line2surfacetension.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/line2surfacetension.C.o.d"
+  "/root/repo/src/fm/linesurfacetension.C" "src/fm/CMakeFiles/fm.dir/linesurfacetension.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/linesurfacetension.C.o.d"
+  "/root/repo/src/fm/newtonianfluid.C" "src/fm/CMakeFiles/fm.dir/newtonianfluid.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/newtonianfluid.C.o.d"
+  "/root/repo/src/fm/nonlinearfluidmaterial.C" "src/fm/CMakeFiles/fm.dir/nonlinearfluidmaterial.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/nonlinearfluidmaterial.C.o.d"
+  "/root/repo/src/fm/quad10_2d_supg.C" "src/fm/CMakeFiles/fm.dir/quad10_2d_supg.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/quad10_2d_supg.C.o.d"
+  "/root/repo/src/fm/stokesflow.C" "src/fm/CMakeFiles/fm.dir/stokesflow.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/stokesflow.C.o.d"
+  "/root/repo/src/fm/stokesflowvelocityhomogenization.C" "src/fm/CMakeFiles/fm.dir/stokesflowvelocityhomogenization.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/stokesflowvelocityhomogenization.C.o.d"
+  "/root/repo/src/fm/supg.C" "src/fm/CMakeFiles/fm.dir/supg.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/supg.C.o.d"
+  "/root/repo/src/fm/supgelement.C" "src/fm/CMakeFiles/fm.dir/supgelement.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/supgelement.C.o.d"
+  "/root/repo/src/fm/supgelement2.C" "src/fm/CMakeFiles/fm.dir/supgelement2.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/supgelement2.C.o.d"
+  "/root/repo/src/fm/surfacetensionmaterial.C" "src/fm/CMakeFiles/fm.dir/surfacetensionmaterial.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/surfacetensionmaterial.C.o.d"
+  "/root/repo/src/fm/tet1_3d_supg.C" "src/fm/CMakeFiles/fm.dir/tet1_3d_supg.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/tet1_3d_supg.C.o.d"
+  "/root/repo/src/fm/tet1bubblestokes.C" "src/fm/CMakeFiles/fm.dir/tet1bubblestokes.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/tet1bubblestokes.C.o.d"
+  "/root/repo/src/fm/tet21stokes.C" "src/fm/CMakeFiles/fm.dir/tet21stokes.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/tet21stokes.C.o.d"
+  "/root/repo/src/fm/tr1_2d_cbs.C" "src/fm/CMakeFiles/fm.dir/tr1_2d_cbs.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/tr1_2d_cbs.C.o.d"
+  "/root/repo/src/fm/tr1_2d_supg.C" "src/fm/CMakeFiles/fm.dir/tr1_2d_supg.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/tr1_2d_supg.C.o.d"
+  "/root/repo/src/fm/tr1_2d_supg2.C" "src/fm/CMakeFiles/fm.dir/tr1_2d_supg2.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/tr1_2d_supg2.C.o.d"
+  "/root/repo/src/fm/tr1_2d_supg2_axi.C" "src/fm/CMakeFiles/fm.dir/tr1_2d_supg2_axi.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/tr1_2d_supg2_axi.C.o.d"
+  "/root/repo/src/fm/tr1_2d_supg_axi.C" "src/fm/CMakeFiles/fm.dir/tr1_2d_supg_axi.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/tr1_2d_supg_axi.C.o.d"
+  "/root/repo/src/fm/tr1bubblestokes.C" "src/fm/CMakeFiles/fm.dir/tr1bubblestokes.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/tr1bubblestokes.C.o.d"
+  "/root/repo/src/fm/tr21_2d_supg.C" "src/fm/CMakeFiles/fm.dir/tr21_2d_supg.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/tr21_2d_supg.C.o.d"
+  "/root/repo/src/fm/tr21stokes.C" "src/fm/CMakeFiles/fm.dir/tr21stokes.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/tr21stokes.C.o.d"
+  "/root/repo/src/fm/tractionpressurebc.C" "src/fm/CMakeFiles/fm.dir/tractionpressurebc.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/tractionpressurebc.C.o.d"
+  "/root/repo/src/fm/twofluidmaterial.C" "src/fm/CMakeFiles/fm.dir/twofluidmaterial.C.o" "gcc" "src/fm/CMakeFiles/fm.dir/twofluidmaterial.C.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
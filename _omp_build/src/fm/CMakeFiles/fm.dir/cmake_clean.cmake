@@ -0,0 +1,83 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fm.dir/binghamfluid2.C.o"
+  "CMakeFiles/fm.dir/binghamfluid2.C.o.d"
+  "CMakeFiles/fm.dir/cbs.C.o"
+  "CMakeFiles/fm.dir/cbs.C.o.d"
+  "CMakeFiles/fm.dir/cbselement.C.o"
+  "CMakeFiles/fm.dir/cbselement.C.o.d"
+  "CMakeFiles/fm.dir/fastmarchingmethod.C.o"
+  "CMakeFiles/fm.dir/fastmarchingmethod.C.o.d"
+  "CMakeFiles/fm.dir/fe2fluidmaterial.C.o"
+  "CMakeFiles/fm.dir/fe2fluidmaterial.C.o.d"
+  "CMakeFiles/fm.dir/fluiddynamicmaterial.C.o"
+  "CMakeFiles/fm.dir/fluiddynamicmaterial.C.o.d"
+  "CMakeFiles/fm.dir/fluidmaterialevaluator.C.o"
+  "CMakeFiles/fm.dir/fluidmaterialevaluator.C.o.d"
+  "CMakeFiles/fm.dir/fluidmodel.C.o"
+  "CMakeFiles/fm.dir/fluidmodel.C.o.d"
+  "CMakeFiles/fm.dir/fmelement.C.o"
+  "CMakeFiles/fm.dir/fmelement.C.o.d"
+  "CMakeFiles/fm.dir/hexa1bubblestokes.C.o"
+  "CMakeFiles/fm.dir/hexa1bubblestokes.C.o.d"
+  "CMakeFiles/fm.dir/hexa21stokes.C.o"
+  "CMakeFiles/fm.dir/hexa21stokes.C.o.d"
+  "CMakeFiles/fm.dir/leplic.C.o"
+  "CMakeFiles/fm.dir/leplic.C.o.d"
+  "CMakeFiles/fm.dir/levelsetpcs.C.o"
+  "CMakeFiles/fm.dir/levelsetpcs.C.o.d"
+  "CMakeFiles/fm.dir/line2boundaryelement.C.o"
+  "CMakeFiles/fm.dir/line2boundaryelement.C.o.d"
+  "CMakeFiles/fm.dir/line2surfacetension.C.o"
+  "CMakeFiles/fm.dir/line2surfacetension.C.o.d"
+  "CMakeFiles/fm.dir/linesurfacetension.C.o"
+  "CMakeFiles/fm.dir/linesurfacetension.C.o.d"
+  "CMakeFiles/fm.dir/newtonianfluid.C.o"
+  "CMakeFiles/fm.dir/newtonianfluid.C.o.d"
+  "CMakeFiles/fm.dir/nonlinearfluidmaterial.C.o"
+  "CMakeFiles/fm.dir/nonlinearfluidmaterial.C.o.d"
+  "CMakeFiles/fm.dir/quad10_2d_supg.C.o"
+  "CMakeFiles/fm.dir/quad10_2d_supg.C.o.d"
+  "CMakeFiles/fm.dir/stokesflow.C.o"
+  "CMakeFiles/fm.dir/stokesflow.C.o.d"
+  "CMakeFiles/fm.dir/stokesflowvelocityhomogenization.C.o"
+  "CMakeFiles/fm.dir/stokesflowvelocityhomogenization.C.o.d"
+  "CMakeFiles/fm.dir/supg.C.o"
+  "CMakeFiles/fm.dir/supg.C.o.d"
+  "CMakeFiles/fm.dir/supgelement.C.o"
+  "CMakeFiles/fm.dir/supgelement.C.o.d"
+  "CMakeFiles/fm.dir/supgelement2.C.o"
+  "CMakeFiles/fm.dir/supgelement2.C.o.d"
+  "CMakeFiles/fm.dir/surfacetensionmaterial.C.o"
+  "CMakeFiles/fm.dir/surfacetensionmaterial.C.o.d"
+  "CMakeFiles/fm.dir/tet1_3d_supg.C.o"
+  "CMakeFiles/fm.dir/tet1_3d_supg.C.o.d"
+  "CMakeFiles/fm.dir/tet1bubblestokes.C.o"
+  "CMakeFiles/fm.dir/tet1bubblestokes.C.o.d"
+  "CMakeFiles/fm.dir/tet21stokes.C.o"
+  "CMakeFiles/fm.dir/tet21stokes.C.o.d"
+  "CMakeFiles/fm.dir/tr1_2d_cbs.C.o"
+  "CMakeFiles/fm.dir/tr1_2d_cbs.C.o.d"
+  "CMakeFiles/fm.dir/tr1_2d_supg.C.o"
+  "CMakeFiles/fm.dir/tr1_2d_supg.C.o.d"
+  "CMakeFiles/fm.dir/tr1_2d_supg2.C.o"
+  "CMakeFiles/fm.dir/tr1_2d_supg2.C.o.d"
+  "CMakeFiles/fm.dir/tr1_2d_supg2_axi.C.o"
+  "CMakeFiles/fm.dir/tr1_2d_supg2_axi.C.o.d"
+  "CMakeFiles/fm.dir/tr1_2d_supg_axi.C.o"
+  "CMakeFiles/fm.dir/tr1_2d_supg_axi.C.o.d"
+  "CMakeFiles/fm.dir/tr1bubblestokes.C.o"
+  "CMakeFiles/fm.dir/tr1bubblestokes.C.o.d"
+  "CMakeFiles/fm.dir/tr21_2d_supg.C.o"
+  "CMakeFiles/fm.dir/tr21_2d_supg.C.o.d"
+  "CMakeFiles/fm.dir/tr21stokes.C.o"
+  "CMakeFiles/fm.dir/tr21stokes.C.o.d"
+  "CMakeFiles/fm.dir/tractionpressurebc.C.o"
+  "CMakeFiles/fm.dir/tractionpressurebc.C.o.d"
+  "CMakeFiles/fm.dir/twofluidmaterial.C.o"
+  "CMakeFiles/fm.dir/twofluidmaterial.C.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
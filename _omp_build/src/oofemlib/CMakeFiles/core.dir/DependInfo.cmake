@@ -0,0 +1,223 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/oofemlib/activedof.C" "src/oofemlib/CMakeFiles/core.dir/activedof.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/activedof.C.o.d"
+  "/root/repo/src/oofemlib/boundarycondition.C" "src/oofemlib/CMakeFiles/core.dir/boundarycondition.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/boundarycondition.C.o.d"
+  "/root/repo/src/oofemlib/boundaryload.C" "src/oofemlib/CMakeFiles/core.dir/boundaryload.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/boundaryload.C.o.d"
+  "/root/repo/src/oofemlib/boundingvolumetree.C" "src/oofemlib/CMakeFiles/core.dir/boundingvolumetree.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/boundingvolumetree.C.o.d"
+  "/root/repo/src/oofemlib/buffereddatareader.C" "src/oofemlib/CMakeFiles/core.dir/buffereddatareader.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/buffereddatareader.C.o.d"
+  "/root/repo/src/oofemlib/calmls.C" "src/oofemlib/CMakeFiles/core.dir/calmls.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/calmls.C.o.d"
+  "/root/repo/src/oofemlib/classfactory.C" "src/oofemlib/CMakeFiles/core.dir/classfactory.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/classfactory.C.o.d"
+  "/root/repo/src/oofemlib/cltypes.C" "src/oofemlib/CMakeFiles/core.dir/cltypes.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/cltypes.C.o.d"
+  "/root/repo/src/oofemlib/combuff.C" "src/oofemlib/CMakeFiles/core.dir/combuff.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/combuff.C.o.d"
+  "/root/repo/src/oofemlib/communicator.C" "src/oofemlib/CMakeFiles/core.dir/communicator.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/communicator.C.o.d"
+  "/root/repo/src/oofemlib/compiler.C" "src/oofemlib/CMakeFiles/core.dir/compiler.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/compiler.C.o.d"
+  "/root/repo/src/oofemlib/connectivitytable.C" "src/oofemlib/CMakeFiles/core.dir/connectivitytable.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/connectivitytable.C.o.d"
+  "/root/repo/src/oofemlib/constantedgeload.C" "src/oofemlib/CMakeFiles/core.dir/constantedgeload.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/constantedgeload.C.o.d"
+  "/root/repo/src/oofemlib/constantfunction.C" "src/oofemlib/CMakeFiles/core.dir/constantfunction.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/constantfunction.C.o.d"
+  "/root/repo/src/oofemlib/constantsurfaceload.C" "src/oofemlib/CMakeFiles/core.dir/constantsurfaceload.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/constantsurfaceload.C.o.d"
+  "/root/repo/src/oofemlib/crosssection.C" "src/oofemlib/CMakeFiles/core.dir/crosssection.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/crosssection.C.o.d"
+  "/root/repo/src/oofemlib/datastream.C" "src/oofemlib/CMakeFiles/core.dir/datastream.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/datastream.C.o.d"
+  "/root/repo/src/oofemlib/deadweight.C" "src/oofemlib/CMakeFiles/core.dir/deadweight.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/deadweight.C.o.d"
+  "/root/repo/src/oofemlib/dictionary.C" "src/oofemlib/CMakeFiles/core.dir/dictionary.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/dictionary.C.o.d"
+  "/root/repo/src/oofemlib/dof.C" "src/oofemlib/CMakeFiles/core.dir/dof.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/dof.C.o.d"
+  "/root/repo/src/oofemlib/dofdistributedprimaryfield.C" "src/oofemlib/CMakeFiles/core.dir/dofdistributedprimaryfield.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/dofdistributedprimaryfield.C.o.d"
+  "/root/repo/src/oofemlib/dofmanager.C" "src/oofemlib/CMakeFiles/core.dir/dofmanager.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/dofmanager.C.o.d"
+  "/root/repo/src/oofemlib/dofmanvalfield.C" "src/oofemlib/CMakeFiles/core.dir/dofmanvalfield.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/dofmanvalfield.C.o.d"
+  "/root/repo/src/oofemlib/dofunknownsstore.C" "src/oofemlib/CMakeFiles/core.dir/dofunknownsstore.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/dofunknownsstore.C.o.d"
+  "/root/repo/src/oofemlib/domain.C" "src/oofemlib/CMakeFiles/core.dir/domain.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/domain.C.o.d"
+  "/root/repo/src/oofemlib/domaintransactionmanager.C" "src/oofemlib/CMakeFiles/core.dir/domaintransactionmanager.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/domaintransactionmanager.C.o.d"
+  "/root/repo/src/oofemlib/dummylocalizer.C" "src/oofemlib/CMakeFiles/core.dir/dummylocalizer.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/dummylocalizer.C.o.d"
+  "/root/repo/src/oofemlib/dummymaterial.C" "src/oofemlib/CMakeFiles/core.dir/dummymaterial.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/dummymaterial.C.o.d"
+  "/root/repo/src/oofemlib/dynamicdatareader.C" "src/oofemlib/CMakeFiles/core.dir/dynamicdatareader.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/dynamicdatareader.C.o.d"
+  "/root/repo/src/oofemlib/dynamicinputrecord.C" "src/oofemlib/CMakeFiles/core.dir/dynamicinputrecord.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/dynamicinputrecord.C.o.d"
+  "/root/repo/src/oofemlib/dyncombuff.C" "src/oofemlib/CMakeFiles/core.dir/dyncombuff.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/dyncombuff.C.o.d"
+  "/root/repo/src/oofemlib/element.C" "src/oofemlib/CMakeFiles/core.dir/element.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/element.C.o.d"
+  "/root/repo/src/oofemlib/elementinternaldofman.C" "src/oofemlib/CMakeFiles/core.dir/elementinternaldofman.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/elementinternaldofman.C.o.d"
+  "/root/repo/src/oofemlib/elementside.C" "src/oofemlib/CMakeFiles/core.dir/elementside.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/elementside.C.o.d"
+  "/root/repo/src/oofemlib/eleminterpunknownmapper.C" "src/oofemlib/CMakeFiles/core.dir/eleminterpunknownmapper.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/eleminterpunknownmapper.C.o.d"
+  "/root/repo/src/oofemlib/emptycs.C" "src/oofemlib/CMakeFiles/core.dir/emptycs.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/emptycs.C.o.d"
+  "/root/repo/src/oofemlib/engngm.C" "src/oofemlib/CMakeFiles/core.dir/engngm.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/engngm.C.o.d"
+  "/root/repo/src/oofemlib/error.C" "src/oofemlib/CMakeFiles/core.dir/error.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/error.C.o.d"
+  "/root/repo/src/oofemlib/errorestimator.C" "src/oofemlib/CMakeFiles/core.dir/errorestimator.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/errorestimator.C.o.d"
+  "/root/repo/src/oofemlib/exportmodule.C" "src/oofemlib/CMakeFiles/core.dir/exportmodule.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/exportmodule.C.o.d"
+  "/root/repo/src/oofemlib/exportmodulemanager.C" "src/oofemlib/CMakeFiles/core.dir/exportmodulemanager.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/exportmodulemanager.C.o.d"
+  "/root/repo/src/oofemlib/externalfieldgenerator.C" "src/oofemlib/CMakeFiles/core.dir/externalfieldgenerator.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/externalfieldgenerator.C.o.d"
+  "/root/repo/src/oofemlib/fei1dhermite.C" "src/oofemlib/CMakeFiles/core.dir/fei1dhermite.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei1dhermite.C.o.d"
+  "/root/repo/src/oofemlib/fei1dlin.C" "src/oofemlib/CMakeFiles/core.dir/fei1dlin.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei1dlin.C.o.d"
+  "/root/repo/src/oofemlib/fei1dquad.C" "src/oofemlib/CMakeFiles/core.dir/fei1dquad.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei1dquad.C.o.d"
+  "/root/repo/src/oofemlib/fei2dlinehermite.C" "src/oofemlib/CMakeFiles/core.dir/fei2dlinehermite.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei2dlinehermite.C.o.d"
+  "/root/repo/src/oofemlib/fei2dlinelin.C" "src/oofemlib/CMakeFiles/core.dir/fei2dlinelin.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei2dlinelin.C.o.d"
+  "/root/repo/src/oofemlib/fei2dlinequad.C" "src/oofemlib/CMakeFiles/core.dir/fei2dlinequad.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei2dlinequad.C.o.d"
+  "/root/repo/src/oofemlib/fei2dquadbiquad.C" "src/oofemlib/CMakeFiles/core.dir/fei2dquadbiquad.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei2dquadbiquad.C.o.d"
+  "/root/repo/src/oofemlib/fei2dquadconst.C" "src/oofemlib/CMakeFiles/core.dir/fei2dquadconst.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei2dquadconst.C.o.d"
+  "/root/repo/src/oofemlib/fei2dquadlin.C" "src/oofemlib/CMakeFiles/core.dir/fei2dquadlin.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei2dquadlin.C.o.d"
+  "/root/repo/src/oofemlib/fei2dquadquad.C" "src/oofemlib/CMakeFiles/core.dir/fei2dquadquad.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei2dquadquad.C.o.d"
+  "/root/repo/src/oofemlib/fei2dtrlin.C" "src/oofemlib/CMakeFiles/core.dir/fei2dtrlin.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei2dtrlin.C.o.d"
+  "/root/repo/src/oofemlib/fei2dtrquad.C" "src/oofemlib/CMakeFiles/core.dir/fei2dtrquad.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei2dtrquad.C.o.d"
+  "/root/repo/src/oofemlib/fei3dhexalin.C" "src/oofemlib/CMakeFiles/core.dir/fei3dhexalin.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei3dhexalin.C.o.d"
+  "/root/repo/src/oofemlib/fei3dhexaquad.C" "src/oofemlib/CMakeFiles/core.dir/fei3dhexaquad.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei3dhexaquad.C.o.d"
+  "/root/repo/src/oofemlib/fei3dhexatriquad.C" "src/oofemlib/CMakeFiles/core.dir/fei3dhexatriquad.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei3dhexatriquad.C.o.d"
+  "/root/repo/src/oofemlib/fei3dlinelin.C" "src/oofemlib/CMakeFiles/core.dir/fei3dlinelin.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei3dlinelin.C.o.d"
+  "/root/repo/src/oofemlib/fei3dtetlin.C" "src/oofemlib/CMakeFiles/core.dir/fei3dtetlin.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei3dtetlin.C.o.d"
+  "/root/repo/src/oofemlib/fei3dtetquad.C" "src/oofemlib/CMakeFiles/core.dir/fei3dtetquad.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei3dtetquad.C.o.d"
+  "/root/repo/src/oofemlib/fei3dtrquad.C" "src/oofemlib/CMakeFiles/core.dir/fei3dtrquad.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei3dtrquad.C.o.d"
+  "/root/repo/src/oofemlib/fei3dwedgelin.C" "src/oofemlib/CMakeFiles/core.dir/fei3dwedgelin.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei3dwedgelin.C.o.d"
+  "/root/repo/src/oofemlib/fei3dwedgequad.C" "src/oofemlib/CMakeFiles/core.dir/fei3dwedgequad.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fei3dwedgequad.C.o.d"
+  "/root/repo/src/oofemlib/feinterpol.C" "src/oofemlib/CMakeFiles/core.dir/feinterpol.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/feinterpol.C.o.d"
+  "/root/repo/src/oofemlib/feinterpol1d.C" "src/oofemlib/CMakeFiles/core.dir/feinterpol1d.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/feinterpol1d.C.o.d"
+  "/root/repo/src/oofemlib/feinterpol2d.C" "src/oofemlib/CMakeFiles/core.dir/feinterpol2d.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/feinterpol2d.C.o.d"
+  "/root/repo/src/oofemlib/feinterpol3d.C" "src/oofemlib/CMakeFiles/core.dir/feinterpol3d.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/feinterpol3d.C.o.d"
+  "/root/repo/src/oofemlib/femcmpnn.C" "src/oofemlib/CMakeFiles/core.dir/femcmpnn.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/femcmpnn.C.o.d"
+  "/root/repo/src/oofemlib/field.C" "src/oofemlib/CMakeFiles/core.dir/field.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/field.C.o.d"
+  "/root/repo/src/oofemlib/fieldmanager.C" "src/oofemlib/CMakeFiles/core.dir/fieldmanager.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/fieldmanager.C.o.d"
+  "/root/repo/src/oofemlib/floatarray.C" "src/oofemlib/CMakeFiles/core.dir/floatarray.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/floatarray.C.o.d"
+  "/root/repo/src/oofemlib/floatmatrix.C" "src/oofemlib/CMakeFiles/core.dir/floatmatrix.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/floatmatrix.C.o.d"
+  "/root/repo/src/oofemlib/freeminterface.C" "src/oofemlib/CMakeFiles/core.dir/freeminterface.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/freeminterface.C.o.d"
+  "/root/repo/src/oofemlib/gaussintegrationrule.C" "src/oofemlib/CMakeFiles/core.dir/gaussintegrationrule.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/gaussintegrationrule.C.o.d"
+  "/root/repo/src/oofemlib/gausspoint.C" "src/oofemlib/CMakeFiles/core.dir/gausspoint.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/gausspoint.C.o.d"
+  "/root/repo/src/oofemlib/generalboundarycondition.C" "src/oofemlib/CMakeFiles/core.dir/generalboundarycondition.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/generalboundarycondition.C.o.d"
+  "/root/repo/src/oofemlib/geometry.C" "src/oofemlib/CMakeFiles/core.dir/geometry.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/geometry.C.o.d"
+  "/root/repo/src/oofemlib/geotoolbox.C" "src/oofemlib/CMakeFiles/core.dir/geotoolbox.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/geotoolbox.C.o.d"
+  "/root/repo/src/oofemlib/gjacobi.C" "src/oofemlib/CMakeFiles/core.dir/gjacobi.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/gjacobi.C.o.d"
+  "/root/repo/src/oofemlib/gpexportmodule.C" "src/oofemlib/CMakeFiles/core.dir/gpexportmodule.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/gpexportmodule.C.o.d"
+  "/root/repo/src/oofemlib/hangingnode.C" "src/oofemlib/CMakeFiles/core.dir/hangingnode.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/hangingnode.C.o.d"
+  "/root/repo/src/oofemlib/heavisideltf.C" "src/oofemlib/CMakeFiles/core.dir/heavisideltf.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/heavisideltf.C.o.d"
+  "/root/repo/src/oofemlib/homexportmodule.C" "src/oofemlib/CMakeFiles/core.dir/homexportmodule.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/homexportmodule.C.o.d"
+  "/root/repo/src/oofemlib/homogenize.C" "src/oofemlib/CMakeFiles/core.dir/homogenize.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/homogenize.C.o.d"
+  "/root/repo/src/oofemlib/iga/feibspline.C" "src/oofemlib/CMakeFiles/core.dir/iga/feibspline.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/iga/feibspline.C.o.d"
+  "/root/repo/src/oofemlib/iga/feinurbs.C" "src/oofemlib/CMakeFiles/core.dir/iga/feinurbs.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/iga/feinurbs.C.o.d"
+  "/root/repo/src/oofemlib/iga/feitspline.C" "src/oofemlib/CMakeFiles/core.dir/iga/feitspline.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/iga/feitspline.C.o.d"
+  "/root/repo/src/oofemlib/iga/iga.C" "src/oofemlib/CMakeFiles/core.dir/iga/iga.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/iga/iga.C.o.d"
+  "/root/repo/src/oofemlib/initialcondition.C" "src/oofemlib/CMakeFiles/core.dir/initialcondition.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/initialcondition.C.o.d"
+  "/root/repo/src/oofemlib/initmodule.C" "src/oofemlib/CMakeFiles/core.dir/initmodule.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/initmodule.C.o.d"
+  "/root/repo/src/oofemlib/initmodulemanager.C" "src/oofemlib/CMakeFiles/core.dir/initmodulemanager.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/initmodulemanager.C.o.d"
+  "/root/repo/src/oofemlib/inputrecord.C" "src/oofemlib/CMakeFiles/core.dir/inputrecord.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/inputrecord.C.o.d"
+  "/root/repo/src/oofemlib/intarray.C" "src/oofemlib/CMakeFiles/core.dir/intarray.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/intarray.C.o.d"
+  "/root/repo/src/oofemlib/integrationpointstatus.C" "src/oofemlib/CMakeFiles/core.dir/integrationpointstatus.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/integrationpointstatus.C.o.d"
+  "/root/repo/src/oofemlib/integrationrule.C" "src/oofemlib/CMakeFiles/core.dir/integrationrule.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/integrationrule.C.o.d"
+  "/root/repo/src/oofemlib/intvarfield.C" "src/oofemlib/CMakeFiles/core.dir/intvarfield.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/intvarfield.C.o.d"
+  "/root/repo/src/oofemlib/inverseit.C" "src/oofemlib/CMakeFiles/core.dir/inverseit.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/inverseit.C.o.d"
+  "/root/repo/src/oofemlib/ldltfact.C" "src/oofemlib/CMakeFiles/core.dir/ldltfact.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/ldltfact.C.o.d"
+  "/root/repo/src/oofemlib/linearconstraintbc.C" "src/oofemlib/CMakeFiles/core.dir/linearconstraintbc.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/linearconstraintbc.C.o.d"
+  "/root/repo/src/oofemlib/linearedgeload.C" "src/oofemlib/CMakeFiles/core.dir/linearedgeload.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/linearedgeload.C.o.d"
+  "/root/repo/src/oofemlib/linesearch.C" "src/oofemlib/CMakeFiles/core.dir/linesearch.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/linesearch.C.o.d"
+  "/root/repo/src/oofemlib/load.C" "src/oofemlib/CMakeFiles/core.dir/load.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/load.C.o.d"
+  "/root/repo/src/oofemlib/loadbalancer.C" "src/oofemlib/CMakeFiles/core.dir/loadbalancer.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/loadbalancer.C.o.d"
+  "/root/repo/src/oofemlib/loadtimefunction.C" "src/oofemlib/CMakeFiles/core.dir/loadtimefunction.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/loadtimefunction.C.o.d"
+  "/root/repo/src/oofemlib/lobattoir.C" "src/oofemlib/CMakeFiles/core.dir/lobattoir.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/lobattoir.C.o.d"
+  "/root/repo/src/oofemlib/localgaussianrandomgenerator.C" "src/oofemlib/CMakeFiles/core.dir/localgaussianrandomgenerator.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/localgaussianrandomgenerator.C.o.d"
+  "/root/repo/src/oofemlib/logger.C" "src/oofemlib/CMakeFiles/core.dir/logger.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/logger.C.o.d"
+  "/root/repo/src/oofemlib/maskedprimaryfield.C" "src/oofemlib/CMakeFiles/core.dir/maskedprimaryfield.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/maskedprimaryfield.C.o.d"
+  "/root/repo/src/oofemlib/masterdof.C" "src/oofemlib/CMakeFiles/core.dir/masterdof.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/masterdof.C.o.d"
+  "/root/repo/src/oofemlib/material.C" "src/oofemlib/CMakeFiles/core.dir/material.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/material.C.o.d"
+  "/root/repo/src/oofemlib/materialmappingalgorithm.C" "src/oofemlib/CMakeFiles/core.dir/materialmappingalgorithm.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/materialmappingalgorithm.C.o.d"
+  "/root/repo/src/oofemlib/mathfem.C" "src/oofemlib/CMakeFiles/core.dir/mathfem.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/mathfem.C.o.d"
+  "/root/repo/src/oofemlib/matlabexportmodule.C" "src/oofemlib/CMakeFiles/core.dir/matlabexportmodule.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/matlabexportmodule.C.o.d"
+  "/root/repo/src/oofemlib/meshqualityerrorestimator.C" "src/oofemlib/CMakeFiles/core.dir/meshqualityerrorestimator.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/meshqualityerrorestimator.C.o.d"
+  "/root/repo/src/oofemlib/metastep.C" "src/oofemlib/CMakeFiles/core.dir/metastep.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/metastep.C.o.d"
+  "/root/repo/src/oofemlib/mixedgradientpressurebc.C" "src/oofemlib/CMakeFiles/core.dir/mixedgradientpressurebc.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/mixedgradientpressurebc.C.o.d"
+  "/root/repo/src/oofemlib/mixedgradientpressuredirichlet.C" "src/oofemlib/CMakeFiles/core.dir/mixedgradientpressuredirichlet.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/mixedgradientpressuredirichlet.C.o.d"
+  "/root/repo/src/oofemlib/mixedgradientpressureneumann.C" "src/oofemlib/CMakeFiles/core.dir/mixedgradientpressureneumann.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/mixedgradientpressureneumann.C.o.d"
+  "/root/repo/src/oofemlib/mixedgradientpressureweakperiodic.C" "src/oofemlib/CMakeFiles/core.dir/mixedgradientpressureweakperiodic.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/mixedgradientpressureweakperiodic.C.o.d"
+  "/root/repo/src/oofemlib/mmaclosestiptransfer.C" "src/oofemlib/CMakeFiles/core.dir/mmaclosestiptransfer.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/mmaclosestiptransfer.C.o.d"
+  "/root/repo/src/oofemlib/mmacontainingelementprojection.C" "src/oofemlib/CMakeFiles/core.dir/mmacontainingelementprojection.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/mmacontainingelementprojection.C.o.d"
+  "/root/repo/src/oofemlib/mmaleastsquareprojection.C" "src/oofemlib/CMakeFiles/core.dir/mmaleastsquareprojection.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/mmaleastsquareprojection.C.o.d"
+  "/root/repo/src/oofemlib/mmashapefunctprojection.C" "src/oofemlib/CMakeFiles/core.dir/mmashapefunctprojection.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/mmashapefunctprojection.C.o.d"
+  "/root/repo/src/oofemlib/nodalaveragingrecoverymodel.C" "src/oofemlib/CMakeFiles/core.dir/nodalaveragingrecoverymodel.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/nodalaveragingrecoverymodel.C.o.d"
+  "/root/repo/src/oofemlib/nodalload.C" "src/oofemlib/CMakeFiles/core.dir/nodalload.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/nodalload.C.o.d"
+  "/root/repo/src/oofemlib/nodalrecoverymodel.C" "src/oofemlib/CMakeFiles/core.dir/nodalrecoverymodel.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/nodalrecoverymodel.C.o.d"
+  "/root/repo/src/oofemlib/node.C" "src/oofemlib/CMakeFiles/core.dir/node.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/node.C.o.d"
+  "/root/repo/src/oofemlib/nonlocalbarrier.C" "src/oofemlib/CMakeFiles/core.dir/nonlocalbarrier.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/nonlocalbarrier.C.o.d"
+  "/root/repo/src/oofemlib/nonlocalmaterialext.C" "src/oofemlib/CMakeFiles/core.dir/nonlocalmaterialext.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/nonlocalmaterialext.C.o.d"
+  "/root/repo/src/oofemlib/nonlocalmatwtp.C" "src/oofemlib/CMakeFiles/core.dir/nonlocalmatwtp.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/nonlocalmatwtp.C.o.d"
+  "/root/repo/src/oofemlib/nrsolver.C" "src/oofemlib/CMakeFiles/core.dir/nrsolver.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/nrsolver.C.o.d"
+  "/root/repo/src/oofemlib/octreelocalizer.C" "src/oofemlib/CMakeFiles/core.dir/octreelocalizer.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/octreelocalizer.C.o.d"
+  "/root/repo/src/oofemlib/oofeggraphiccontext.C" "src/oofemlib/CMakeFiles/core.dir/oofeggraphiccontext.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/oofeggraphiccontext.C.o.d"
+  "/root/repo/src/oofemlib/oofembindatareader.C" "src/oofemlib/CMakeFiles/core.dir/oofembindatareader.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/oofembindatareader.C.o.d"
+  "/root/repo/src/oofemlib/oofembininputrecord.C" "src/oofemlib/CMakeFiles/core.dir/oofembininputrecord.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/oofembininputrecord.C.o.d"
+  "/root/repo/src/oofemlib/oofemtxtdatareader.C" "src/oofemlib/CMakeFiles/core.dir/oofemtxtdatareader.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/oofemtxtdatareader.C.o.d"
+  "/root/repo/src/oofemlib/oofemtxtinputrecord.C" "src/oofemlib/CMakeFiles/core.dir/oofemtxtinputrecord.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/oofemtxtinputrecord.C.o.d"
+  "/root/repo/src/oofemlib/outputmanager.C" "src/oofemlib/CMakeFiles/core.dir/outputmanager.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/outputmanager.C.o.d"
+  "/root/repo/src/oofemlib/parallelordering.C" "src/oofemlib/CMakeFiles/core.dir/parallelordering.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/parallelordering.C.o.d"
+  "/root/repo/src/oofemlib/parmetisloadbalancer.C" "src/oofemlib/CMakeFiles/core.dir/parmetisloadbalancer.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/parmetisloadbalancer.C.o.d"
+  "/root/repo/src/oofemlib/parser.C" "src/oofemlib/CMakeFiles/core.dir/parser.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/parser.C.o.d"
+  "/root/repo/src/oofemlib/peakfunction.C" "src/oofemlib/CMakeFiles/core.dir/peakfunction.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/peakfunction.C.o.d"
+  "/root/repo/src/oofemlib/periodicpiecewiselinfunction.C" "src/oofemlib/CMakeFiles/core.dir/periodicpiecewiselinfunction.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/periodicpiecewiselinfunction.C.o.d"
+  "/root/repo/src/oofemlib/petsccontext.C" "src/oofemlib/CMakeFiles/core.dir/petsccontext.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/petsccontext.C.o.d"
+  "/root/repo/src/oofemlib/petscsolver.C" "src/oofemlib/CMakeFiles/core.dir/petscsolver.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/petscsolver.C.o.d"
+  "/root/repo/src/oofemlib/petscsparsemtrx.C" "src/oofemlib/CMakeFiles/core.dir/petscsparsemtrx.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/petscsparsemtrx.C.o.d"
+  "/root/repo/src/oofemlib/piecewiselinfunction.C" "src/oofemlib/CMakeFiles/core.dir/piecewiselinfunction.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/piecewiselinfunction.C.o.d"
+  "/root/repo/src/oofemlib/pointload.C" "src/oofemlib/CMakeFiles/core.dir/pointload.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/pointload.C.o.d"
+  "/root/repo/src/oofemlib/prescribedgradient.C" "src/oofemlib/CMakeFiles/core.dir/prescribedgradient.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/prescribedgradient.C.o.d"
+  "/root/repo/src/oofemlib/primaryfield.C" "src/oofemlib/CMakeFiles/core.dir/primaryfield.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/primaryfield.C.o.d"
+  "/root/repo/src/oofemlib/primaryunknownmapper.C" "src/oofemlib/CMakeFiles/core.dir/primaryunknownmapper.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/primaryunknownmapper.C.o.d"
+  "/root/repo/src/oofemlib/problemcomm.C" "src/oofemlib/CMakeFiles/core.dir/problemcomm.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/problemcomm.C.o.d"
+  "/root/repo/src/oofemlib/processcomm.C" "src/oofemlib/CMakeFiles/core.dir/processcomm.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/processcomm.C.o.d"
+  "/root/repo/src/oofemlib/randommaterialext.C" "src/oofemlib/CMakeFiles/core.dir/randommaterialext.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/randommaterialext.C.o.d"
+  "/root/repo/src/oofemlib/reinforcement.C" "src/oofemlib/CMakeFiles/core.dir/reinforcement.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/reinforcement.C.o.d"
+  "/root/repo/src/oofemlib/remeshingcrit.C" "src/oofemlib/CMakeFiles/core.dir/remeshingcrit.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/remeshingcrit.C.o.d"
+  "/root/repo/src/oofemlib/rigidarmnode.C" "src/oofemlib/CMakeFiles/core.dir/rigidarmnode.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/rigidarmnode.C.o.d"
+  "/root/repo/src/oofemlib/rowcol.C" "src/oofemlib/CMakeFiles/core.dir/rowcol.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/rowcol.C.o.d"
+  "/root/repo/src/oofemlib/rvematerial.C" "src/oofemlib/CMakeFiles/core.dir/rvematerial.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/rvematerial.C.o.d"
+  "/root/repo/src/oofemlib/set.C" "src/oofemlib/CMakeFiles/core.dir/set.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/set.C.o.d"
+  "/root/repo/src/oofemlib/simplecrosssection.C" "src/oofemlib/CMakeFiles/core.dir/simplecrosssection.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/simplecrosssection.C.o.d"
+  "/root/repo/src/oofemlib/simpleslavedof.C" "src/oofemlib/CMakeFiles/core.dir/simpleslavedof.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/simpleslavedof.C.o.d"
+  "/root/repo/src/oofemlib/skyline.C" "src/oofemlib/CMakeFiles/core.dir/skyline.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/skyline.C.o.d"
+  "/root/repo/src/oofemlib/skylineu.C" "src/oofemlib/CMakeFiles/core.dir/skylineu.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/skylineu.C.o.d"
+  "/root/repo/src/oofemlib/slavedof.C" "src/oofemlib/CMakeFiles/core.dir/slavedof.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/slavedof.C.o.d"
+  "/root/repo/src/oofemlib/slavenode.C" "src/oofemlib/CMakeFiles/core.dir/slavenode.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/slavenode.C.o.d"
+  "/root/repo/src/oofemlib/sloangraph.C" "src/oofemlib/CMakeFiles/core.dir/sloangraph.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/sloangraph.C.o.d"
+  "/root/repo/src/oofemlib/sloangraphnode.C" "src/oofemlib/CMakeFiles/core.dir/sloangraphnode.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/sloangraphnode.C.o.d"
+  "/root/repo/src/oofemlib/sloanlevelstruct.C" "src/oofemlib/CMakeFiles/core.dir/sloanlevelstruct.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/sloanlevelstruct.C.o.d"
+  "/root/repo/src/oofemlib/smoothednodalintvarfield.C" "src/oofemlib/CMakeFiles/core.dir/smoothednodalintvarfield.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/smoothednodalintvarfield.C.o.d"
+  "/root/repo/src/oofemlib/solutionbasedshapefunction.C" "src/oofemlib/CMakeFiles/core.dir/solutionbasedshapefunction.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/solutionbasedshapefunction.C.o.d"
+  "/root/repo/src/oofemlib/sparselinsystemnm.C" "src/oofemlib/CMakeFiles/core.dir/sparselinsystemnm.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/sparselinsystemnm.C.o.d"
+  "/root/repo/src/oofemlib/spatiallocalizer.C" "src/oofemlib/CMakeFiles/core.dir/spatiallocalizer.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/spatiallocalizer.C.o.d"
+  "/root/repo/src/oofemlib/sprnodalrecoverymodel.C" "src/oofemlib/CMakeFiles/core.dir/sprnodalrecoverymodel.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/sprnodalrecoverymodel.C.o.d"
+  "/root/repo/src/oofemlib/staggeredproblem.C" "src/oofemlib/CMakeFiles/core.dir/staggeredproblem.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/staggeredproblem.C.o.d"
+  "/root/repo/src/oofemlib/statusarena.C" "src/oofemlib/CMakeFiles/core.dir/statusarena.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/statusarena.C.o.d"
+  "/root/repo/src/oofemlib/strainvector.C" "src/oofemlib/CMakeFiles/core.dir/strainvector.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/strainvector.C.o.d"
+  "/root/repo/src/oofemlib/stressstrainbasevector.C" "src/oofemlib/CMakeFiles/core.dir/stressstrainbasevector.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/stressstrainbasevector.C.o.d"
+  "/root/repo/src/oofemlib/stressvector.C" "src/oofemlib/CMakeFiles/core.dir/stressvector.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/stressvector.C.o.d"
+  "/root/repo/src/oofemlib/subdivision.C" "src/oofemlib/CMakeFiles/core.dir/subdivision.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/subdivision.C.o.d"
+  "/root/repo/src/oofemlib/subspaceit.C" "src/oofemlib/CMakeFiles/core.dir/subspaceit.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/subspaceit.C.o.d"
+  "/root/repo/src/oofemlib/surfacetensionbc.C" "src/oofemlib/CMakeFiles/core.dir/surfacetensionbc.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/surfacetensionbc.C.o.d"
+  "/root/repo/src/oofemlib/t3dinterface.C" "src/oofemlib/CMakeFiles/core.dir/t3dinterface.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/t3dinterface.C.o.d"
+  "/root/repo/src/oofemlib/targe2interface.C" "src/oofemlib/CMakeFiles/core.dir/targe2interface.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/targe2interface.C.o.d"
+  "/root/repo/src/oofemlib/timer.C" "src/oofemlib/CMakeFiles/core.dir/timer.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/timer.C.o.d"
+  "/root/repo/src/oofemlib/timestep.C" "src/oofemlib/CMakeFiles/core.dir/timestep.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/timestep.C.o.d"
+  "/root/repo/src/oofemlib/tokenizer.C" "src/oofemlib/CMakeFiles/core.dir/tokenizer.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/tokenizer.C.o.d"
+  "/root/repo/src/oofemlib/trianglemesherinterface.C" "src/oofemlib/CMakeFiles/core.dir/trianglemesherinterface.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/trianglemesherinterface.C.o.d"
+  "/root/repo/src/oofemlib/userdefinedloadtimefunction.C" "src/oofemlib/CMakeFiles/core.dir/userdefinedloadtimefunction.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/userdefinedloadtimefunction.C.o.d"
+  "/root/repo/src/oofemlib/util.C" "src/oofemlib/CMakeFiles/core.dir/util.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/util.C.o.d"
+  "/root/repo/src/oofemlib/vtkexportmodule.C" "src/oofemlib/CMakeFiles/core.dir/vtkexportmodule.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/vtkexportmodule.C.o.d"
+  "/root/repo/src/oofemlib/vtkxmlexportmodule.C" "src/oofemlib/CMakeFiles/core.dir/vtkxmlexportmodule.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/vtkxmlexportmodule.C.o.d"
+  "/root/repo/src/oofemlib/vtkxmlwriter.C" "src/oofemlib/CMakeFiles/core.dir/vtkxmlwriter.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/vtkxmlwriter.C.o.d"
+  "/root/repo/src/oofemlib/weakperiodicbc.C" "src/oofemlib/CMakeFiles/core.dir/weakperiodicbc.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/weakperiodicbc.C.o.d"
+  "/root/repo/src/oofemlib/xfem/XFEMDebugTools.C" "src/oofemlib/CMakeFiles/core.dir/xfem/XFEMDebugTools.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/xfem/XFEMDebugTools.C.o.d"
+  "/root/repo/src/oofemlib/xfem/delaunay.C" "src/oofemlib/CMakeFiles/core.dir/xfem/delaunay.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/xfem/delaunay.C.o.d"
+  "/root/repo/src/oofemlib/xfem/enrichmentdomain.C" "src/oofemlib/CMakeFiles/core.dir/xfem/enrichmentdomain.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/xfem/enrichmentdomain.C.o.d"
+  "/root/repo/src/oofemlib/xfem/enrichmentfunction.C" "src/oofemlib/CMakeFiles/core.dir/xfem/enrichmentfunction.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/xfem/enrichmentfunction.C.o.d"
+  "/root/repo/src/oofemlib/xfem/enrichmentitem.C" "src/oofemlib/CMakeFiles/core.dir/xfem/enrichmentitem.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/xfem/enrichmentitem.C.o.d"
+  "/root/repo/src/oofemlib/xfem/patch.C" "src/oofemlib/CMakeFiles/core.dir/xfem/patch.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/xfem/patch.C.o.d"
+  "/root/repo/src/oofemlib/xfem/patchintegrationrule.C" "src/oofemlib/CMakeFiles/core.dir/xfem/patchintegrationrule.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/xfem/patchintegrationrule.C.o.d"
+  "/root/repo/src/oofemlib/xfem/propagationlaw.C" "src/oofemlib/CMakeFiles/core.dir/xfem/propagationlaw.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/xfem/propagationlaw.C.o.d"
+  "/root/repo/src/oofemlib/xfem/xfemelementinterface.C" "src/oofemlib/CMakeFiles/core.dir/xfem/xfemelementinterface.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/xfem/xfemelementinterface.C.o.d"
+  "/root/repo/src/oofemlib/xfem/xfemmanager.C" "src/oofemlib/CMakeFiles/core.dir/xfem/xfemmanager.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/xfem/xfemmanager.C.o.d"
+  "/root/repo/src/oofemlib/zznodalrecoverymodel.C" "src/oofemlib/CMakeFiles/core.dir/zznodalrecoverymodel.C.o" "gcc" "src/oofemlib/CMakeFiles/core.dir/zznodalrecoverymodel.C.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,417 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/core.dir/activedof.C.o"
+  "CMakeFiles/core.dir/activedof.C.o.d"
+  "CMakeFiles/core.dir/boundarycondition.C.o"
+  "CMakeFiles/core.dir/boundarycondition.C.o.d"
+  "CMakeFiles/core.dir/boundaryload.C.o"
+  "CMakeFiles/core.dir/boundaryload.C.o.d"
+  "CMakeFiles/core.dir/boundingvolumetree.C.o"
+  "CMakeFiles/core.dir/boundingvolumetree.C.o.d"
+  "CMakeFiles/core.dir/buffereddatareader.C.o"
+  "CMakeFiles/core.dir/buffereddatareader.C.o.d"
+  "CMakeFiles/core.dir/calmls.C.o"
+  "CMakeFiles/core.dir/calmls.C.o.d"
+  "CMakeFiles/core.dir/classfactory.C.o"
+  "CMakeFiles/core.dir/classfactory.C.o.d"
+  "CMakeFiles/core.dir/cltypes.C.o"
+  "CMakeFiles/core.dir/cltypes.C.o.d"
+  "CMakeFiles/core.dir/combuff.C.o"
+  "CMakeFiles/core.dir/combuff.C.o.d"
+  "CMakeFiles/core.dir/communicator.C.o"
+  "CMakeFiles/core.dir/communicator.C.o.d"
+  "CMakeFiles/core.dir/compiler.C.o"
+  "CMakeFiles/core.dir/compiler.C.o.d"
+  "CMakeFiles/core.dir/connectivitytable.C.o"
+  "CMakeFiles/core.dir/connectivitytable.C.o.d"
+  "CMakeFiles/core.dir/constantedgeload.C.o"
+  "CMakeFiles/core.dir/constantedgeload.C.o.d"
+  "CMakeFiles/core.dir/constantfunction.C.o"
+  "CMakeFiles/core.dir/constantfunction.C.o.d"
+  "CMakeFiles/core.dir/constantsurfaceload.C.o"
+  "CMakeFiles/core.dir/constantsurfaceload.C.o.d"
+  "CMakeFiles/core.dir/crosssection.C.o"
+  "CMakeFiles/core.dir/crosssection.C.o.d"
+  "CMakeFiles/core.dir/datastream.C.o"
+  "CMakeFiles/core.dir/datastream.C.o.d"
+  "CMakeFiles/core.dir/deadweight.C.o"
+  "CMakeFiles/core.dir/deadweight.C.o.d"
+  "CMakeFiles/core.dir/dictionary.C.o"
+  "CMakeFiles/core.dir/dictionary.C.o.d"
+  "CMakeFiles/core.dir/dof.C.o"
+  "CMakeFiles/core.dir/dof.C.o.d"
+  "CMakeFiles/core.dir/dofdistributedprimaryfield.C.o"
+  "CMakeFiles/core.dir/dofdistributedprimaryfield.C.o.d"
+  "CMakeFiles/core.dir/dofmanager.C.o"
+  "CMakeFiles/core.dir/dofmanager.C.o.d"
+  "CMakeFiles/core.dir/dofmanvalfield.C.o"
+  "CMakeFiles/core.dir/dofmanvalfield.C.o.d"
+  "CMakeFiles/core.dir/dofunknownsstore.C.o"
+  "CMakeFiles/core.dir/dofunknownsstore.C.o.d"
+  "CMakeFiles/core.dir/domain.C.o"
+  "CMakeFiles/core.dir/domain.C.o.d"
+  "CMakeFiles/core.dir/domaintransactionmanager.C.o"
+  "CMakeFiles/core.dir/domaintransactionmanager.C.o.d"
+  "CMakeFiles/core.dir/dummylocalizer.C.o"
+  "CMakeFiles/core.dir/dummylocalizer.C.o.d"
+  "CMakeFiles/core.dir/dummymaterial.C.o"
+  "CMakeFiles/core.dir/dummymaterial.C.o.d"
+  "CMakeFiles/core.dir/dynamicdatareader.C.o"
+  "CMakeFiles/core.dir/dynamicdatareader.C.o.d"
+  "CMakeFiles/core.dir/dynamicinputrecord.C.o"
+  "CMakeFiles/core.dir/dynamicinputrecord.C.o.d"
+  "CMakeFiles/core.dir/dyncombuff.C.o"
+  "CMakeFiles/core.dir/dyncombuff.C.o.d"
+  "CMakeFiles/core.dir/element.C.o"
+  "CMakeFiles/core.dir/element.C.o.d"
+  "CMakeFiles/core.dir/elementinternaldofman.C.o"
+  "CMakeFiles/core.dir/elementinternaldofman.C.o.d"
+  "CMakeFiles/core.dir/elementside.C.o"
+  "CMakeFiles/core.dir/elementside.C.o.d"
+  "CMakeFiles/core.dir/eleminterpunknownmapper.C.o"
+  "CMakeFiles/core.dir/eleminterpunknownmapper.C.o.d"
+  "CMakeFiles/core.dir/emptycs.C.o"
+  "CMakeFiles/core.dir/emptycs.C.o.d"
+  "CMakeFiles/core.dir/engngm.C.o"
+  "CMakeFiles/core.dir/engngm.C.o.d"
+  "CMakeFiles/core.dir/error.C.o"
+  "CMakeFiles/core.dir/error.C.o.d"
+  "CMakeFiles/core.dir/errorestimator.C.o"
+  "CMakeFiles/core.dir/errorestimator.C.o.d"
+  "CMakeFiles/core.dir/exportmodule.C.o"
+  "CMakeFiles/core.dir/exportmodule.C.o.d"
+  "CMakeFiles/core.dir/exportmodulemanager.C.o"
+  "CMakeFiles/core.dir/exportmodulemanager.C.o.d"
+  "CMakeFiles/core.dir/externalfieldgenerator.C.o"
+  "CMakeFiles/core.dir/externalfieldgenerator.C.o.d"
+  "CMakeFiles/core.dir/fei1dhermite.C.o"
+  "CMakeFiles/core.dir/fei1dhermite.C.o.d"
+  "CMakeFiles/core.dir/fei1dlin.C.o"
+  "CMakeFiles/core.dir/fei1dlin.C.o.d"
+  "CMakeFiles/core.dir/fei1dquad.C.o"
+  "CMakeFiles/core.dir/fei1dquad.C.o.d"
+  "CMakeFiles/core.dir/fei2dlinehermite.C.o"
+  "CMakeFiles/core.dir/fei2dlinehermite.C.o.d"
+  "CMakeFiles/core.dir/fei2dlinelin.C.o"
+  "CMakeFiles/core.dir/fei2dlinelin.C.o.d"
+  "CMakeFiles/core.dir/fei2dlinequad.C.o"
+  "CMakeFiles/core.dir/fei2dlinequad.C.o.d"
+  "CMakeFiles/core.dir/fei2dquadbiquad.C.o"
+  "CMakeFiles/core.dir/fei2dquadbiquad.C.o.d"
+  "CMakeFiles/core.dir/fei2dquadconst.C.o"
+  "CMakeFiles/core.dir/fei2dquadconst.C.o.d"
+  "CMakeFiles/core.dir/fei2dquadlin.C.o"
+  "CMakeFiles/core.dir/fei2dquadlin.C.o.d"
+  "CMakeFiles/core.dir/fei2dquadquad.C.o"
+  "CMakeFiles/core.dir/fei2dquadquad.C.o.d"
+  "CMakeFiles/core.dir/fei2dtrlin.C.o"
+  "CMakeFiles/core.dir/fei2dtrlin.C.o.d"
+  "CMakeFiles/core.dir/fei2dtrquad.C.o"
+  "CMakeFiles/core.dir/fei2dtrquad.C.o.d"
+  "CMakeFiles/core.dir/fei3dhexalin.C.o"
+  "CMakeFiles/core.dir/fei3dhexalin.C.o.d"
+  "CMakeFiles/core.dir/fei3dhexaquad.C.o"
+  "CMakeFiles/core.dir/fei3dhexaquad.C.o.d"
+  "CMakeFiles/core.dir/fei3dhexatriquad.C.o"
+  "CMakeFiles/core.dir/fei3dhexatriquad.C.o.d"
+  "CMakeFiles/core.dir/fei3dlinelin.C.o"
+  "CMakeFiles/core.dir/fei3dlinelin.C.o.d"
+  "CMakeFiles/core.dir/fei3dtetlin.C.o"
+  "CMakeFiles/core.dir/fei3dtetlin.C.o.d"
+  "CMakeFiles/core.dir/fei3dtetquad.C.o"
+  "CMakeFiles/core.dir/fei3dtetquad.C.o.d"
+  "CMakeFiles/core.dir/fei3dtrquad.C.o"
+  "CMakeFiles/core.dir/fei3dtrquad.C.o.d"
+  "CMakeFiles/core.dir/fei3dwedgelin.C.o"
+  "CMakeFiles/core.dir/fei3dwedgelin.C.o.d"
+  "CMakeFiles/core.dir/fei3dwedgequad.C.o"
+  "CMakeFiles/core.dir/fei3dwedgequad.C.o.d"
+  "CMakeFiles/core.dir/feinterpol.C.o"
+  "CMakeFiles/core.dir/feinterpol.C.o.d"
+  "CMakeFiles/core.dir/feinterpol1d.C.o"
+  "CMakeFiles/core.dir/feinterpol1d.C.o.d"
+  "CMakeFiles/core.dir/feinterpol2d.C.o"
+  "CMakeFiles/core.dir/feinterpol2d.C.o.d"
+  "CMakeFiles/core.dir/feinterpol3d.C.o"
+  "CMakeFiles/core.dir/feinterpol3d.C.o.d"
+  "CMakeFiles/core.dir/femcmpnn.C.o"
+  "CMakeFiles/core.dir/femcmpnn.C.o.d"
+  "CMakeFiles/core.dir/field.C.o"
+  "CMakeFiles/core.dir/field.C.o.d"
+  "CMakeFiles/core.dir/fieldmanager.C.o"
+  "CMakeFiles/core.dir/fieldmanager.C.o.d"
+  "CMakeFiles/core.dir/floatarray.C.o"
+  "CMakeFiles/core.dir/floatarray.C.o.d"
+  "CMakeFiles/core.dir/floatmatrix.C.o"
+  "CMakeFiles/core.dir/floatmatrix.C.o.d"
+  "CMakeFiles/core.dir/freeminterface.C.o"
+  "CMakeFiles/core.dir/freeminterface.C.o.d"
+  "CMakeFiles/core.dir/gaussintegrationrule.C.o"
+  "CMakeFiles/core.dir/gaussintegrationrule.C.o.d"
+  "CMakeFiles/core.dir/gausspoint.C.o"
+  "CMakeFiles/core.dir/gausspoint.C.o.d"
+  "CMakeFiles/core.dir/generalboundarycondition.C.o"
+  "CMakeFiles/core.dir/generalboundarycondition.C.o.d"
+  "CMakeFiles/core.dir/geometry.C.o"
+  "CMakeFiles/core.dir/geometry.C.o.d"
+  "CMakeFiles/core.dir/geotoolbox.C.o"
+  "CMakeFiles/core.dir/geotoolbox.C.o.d"
+  "CMakeFiles/core.dir/gjacobi.C.o"
+  "CMakeFiles/core.dir/gjacobi.C.o.d"
+  "CMakeFiles/core.dir/gpexportmodule.C.o"
+  "CMakeFiles/core.dir/gpexportmodule.C.o.d"
+  "CMakeFiles/core.dir/hangingnode.C.o"
+  "CMakeFiles/core.dir/hangingnode.C.o.d"
+  "CMakeFiles/core.dir/heavisideltf.C.o"
+  "CMakeFiles/core.dir/heavisideltf.C.o.d"
+  "CMakeFiles/core.dir/homexportmodule.C.o"
+  "CMakeFiles/core.dir/homexportmodule.C.o.d"
+  "CMakeFiles/core.dir/homogenize.C.o"
+  "CMakeFiles/core.dir/homogenize.C.o.d"
+  "CMakeFiles/core.dir/iga/feibspline.C.o"
+  "CMakeFiles/core.dir/iga/feibspline.C.o.d"
+  "CMakeFiles/core.dir/iga/feinurbs.C.o"
+  "CMakeFiles/core.dir/iga/feinurbs.C.o.d"
+  "CMakeFiles/core.dir/iga/feitspline.C.o"
+  "CMakeFiles/core.dir/iga/feitspline.C.o.d"
+  "CMakeFiles/core.dir/iga/iga.C.o"
+  "CMakeFiles/core.dir/iga/iga.C.o.d"
+  "CMakeFiles/core.dir/initialcondition.C.o"
+  "CMakeFiles/core.dir/initialcondition.C.o.d"
+  "CMakeFiles/core.dir/initmodule.C.o"
+  "CMakeFiles/core.dir/initmodule.C.o.d"
+  "CMakeFiles/core.dir/initmodulemanager.C.o"
+  "CMakeFiles/core.dir/initmodulemanager.C.o.d"
+  "CMakeFiles/core.dir/inputrecord.C.o"
+  "CMakeFiles/core.dir/inputrecord.C.o.d"
+  "CMakeFiles/core.dir/intarray.C.o"
+  "CMakeFiles/core.dir/intarray.C.o.d"
+  "CMakeFiles/core.dir/integrationpointstatus.C.o"
+  "CMakeFiles/core.dir/integrationpointstatus.C.o.d"
+  "CMakeFiles/core.dir/integrationrule.C.o"
+  "CMakeFiles/core.dir/integrationrule.C.o.d"
+  "CMakeFiles/core.dir/intvarfield.C.o"
+  "CMakeFiles/core.dir/intvarfield.C.o.d"
+  "CMakeFiles/core.dir/inverseit.C.o"
+  "CMakeFiles/core.dir/inverseit.C.o.d"
+  "CMakeFiles/core.dir/ldltfact.C.o"
+  "CMakeFiles/core.dir/ldltfact.C.o.d"
+  "CMakeFiles/core.dir/linearconstraintbc.C.o"
+  "CMakeFiles/core.dir/linearconstraintbc.C.o.d"
+  "CMakeFiles/core.dir/linearedgeload.C.o"
+  "CMakeFiles/core.dir/linearedgeload.C.o.d"
+  "CMakeFiles/core.dir/linesearch.C.o"
+  "CMakeFiles/core.dir/linesearch.C.o.d"
+  "CMakeFiles/core.dir/load.C.o"
+  "CMakeFiles/core.dir/load.C.o.d"
+  "CMakeFiles/core.dir/loadbalancer.C.o"
+  "CMakeFiles/core.dir/loadbalancer.C.o.d"
+  "CMakeFiles/core.dir/loadtimefunction.C.o"
+  "CMakeFiles/core.dir/loadtimefunction.C.o.d"
+  "CMakeFiles/core.dir/lobattoir.C.o"
+  "CMakeFiles/core.dir/lobattoir.C.o.d"
+  "CMakeFiles/core.dir/localgaussianrandomgenerator.C.o"
+  "CMakeFiles/core.dir/localgaussianrandomgenerator.C.o.d"
+  "CMakeFiles/core.dir/logger.C.o"
+  "CMakeFiles/core.dir/logger.C.o.d"
+  "CMakeFiles/core.dir/maskedprimaryfield.C.o"
+  "CMakeFiles/core.dir/maskedprimaryfield.C.o.d"
+  "CMakeFiles/core.dir/masterdof.C.o"
+  "CMakeFiles/core.dir/masterdof.C.o.d"
+  "CMakeFiles/core.dir/material.C.o"
+  "CMakeFiles/core.dir/material.C.o.d"
+  "CMakeFiles/core.dir/materialmappingalgorithm.C.o"
+  "CMakeFiles/core.dir/materialmappingalgorithm.C.o.d"
+  "CMakeFiles/core.dir/mathfem.C.o"
+  "CMakeFiles/core.dir/mathfem.C.o.d"
+  "CMakeFiles/core.dir/matlabexportmodule.C.o"
+  "CMakeFiles/core.dir/matlabexportmodule.C.o.d"
+  "CMakeFiles/core.dir/meshqualityerrorestimator.C.o"
+  "CMakeFiles/core.dir/meshqualityerrorestimator.C.o.d"
+  "CMakeFiles/core.dir/metastep.C.o"
+  "CMakeFiles/core.dir/metastep.C.o.d"
+  "CMakeFiles/core.dir/mixedgradientpressurebc.C.o"
+  "CMakeFiles/core.dir/mixedgradientpressurebc.C.o.d"
+  "CMakeFiles/core.dir/mixedgradientpressuredirichlet.C.o"
+  "CMakeFiles/core.dir/mixedgradientpressuredirichlet.C.o.d"
+  "CMakeFiles/core.dir/mixedgradientpressureneumann.C.o"
+  "CMakeFiles/core.dir/mixedgradientpressureneumann.C.o.d"
+  "CMakeFiles/core.dir/mixedgradientpressureweakperiodic.C.o"
+  "CMakeFiles/core.dir/mixedgradientpressureweakperiodic.C.o.d"
+  "CMakeFiles/core.dir/mmaclosestiptransfer.C.o"
+  "CMakeFiles/core.dir/mmaclosestiptransfer.C.o.d"
+  "CMakeFiles/core.dir/mmacontainingelementprojection.C.o"
+  "CMakeFiles/core.dir/mmacontainingelementprojection.C.o.d"
+  "CMakeFiles/core.dir/mmaleastsquareprojection.C.o"
+  "CMakeFiles/core.dir/mmaleastsquareprojection.C.o.d"
+  "CMakeFiles/core.dir/mmashapefunctprojection.C.o"
+  "CMakeFiles/core.dir/mmashapefunctprojection.C.o.d"
+  "CMakeFiles/core.dir/nodalaveragingrecoverymodel.C.o"
+  "CMakeFiles/core.dir/nodalaveragingrecoverymodel.C.o.d"
+  "CMakeFiles/core.dir/nodalload.C.o"
+  "CMakeFiles/core.dir/nodalload.C.o.d"
+  "CMakeFiles/core.dir/nodalrecoverymodel.C.o"
+  "CMakeFiles/core.dir/nodalrecoverymodel.C.o.d"
+  "CMakeFiles/core.dir/node.C.o"
+  "CMakeFiles/core.dir/node.C.o.d"
+  "CMakeFiles/core.dir/nonlocalbarrier.C.o"
+  "CMakeFiles/core.dir/nonlocalbarrier.C.o.d"
+  "CMakeFiles/core.dir/nonlocalmaterialext.C.o"
+  "CMakeFiles/core.dir/nonlocalmaterialext.C.o.d"
+  "CMakeFiles/core.dir/nonlocalmatwtp.C.o"
+  "CMakeFiles/core.dir/nonlocalmatwtp.C.o.d"
+  "CMakeFiles/core.dir/nrsolver.C.o"
+  "CMakeFiles/core.dir/nrsolver.C.o.d"
+  "CMakeFiles/core.dir/octreelocalizer.C.o"
+  "CMakeFiles/core.dir/octreelocalizer.C.o.d"
+  "CMakeFiles/core.dir/oofeggraphiccontext.C.o"
+  "CMakeFiles/core.dir/oofeggraphiccontext.C.o.d"
+  "CMakeFiles/core.dir/oofembindatareader.C.o"
+  "CMakeFiles/core.dir/oofembindatareader.C.o.d"
+  "CMakeFiles/core.dir/oofembininputrecord.C.o"
+  "CMakeFiles/core.dir/oofembininputrecord.C.o.d"
+  "CMakeFiles/core.dir/oofemtxtdatareader.C.o"
+  "CMakeFiles/core.dir/oofemtxtdatareader.C.o.d"
+  "CMakeFiles/core.dir/oofemtxtinputrecord.C.o"
+  "CMakeFiles/core.dir/oofemtxtinputrecord.C.o.d"
+  "CMakeFiles/core.dir/outputmanager.C.o"
+  "CMakeFiles/core.dir/outputmanager.C.o.d"
+  "CMakeFiles/core.dir/parallelordering.C.o"
+  "CMakeFiles/core.dir/parallelordering.C.o.d"
+  "CMakeFiles/core.dir/parmetisloadbalancer.C.o"
+  "CMakeFiles/core.dir/parmetisloadbalancer.C.o.d"
+  "CMakeFiles/core.dir/parser.C.o"
+  "CMakeFiles/core.dir/parser.C.o.d"
+  "CMakeFiles/core.dir/peakfunction.C.o"
+  "CMakeFiles/core.dir/peakfunction.C.o.d"
+  "CMakeFiles/core.dir/periodicpiecewiselinfunction.C.o"
+  "CMakeFiles/core.dir/periodicpiecewiselinfunction.C.o.d"
+  "CMakeFiles/core.dir/petsccontext.C.o"
+  "CMakeFiles/core.dir/petsccontext.C.o.d"
+  "CMakeFiles/core.dir/petscsolver.C.o"
+  "CMakeFiles/core.dir/petscsolver.C.o.d"
+  "CMakeFiles/core.dir/petscsparsemtrx.C.o"
+  "CMakeFiles/core.dir/petscsparsemtrx.C.o.d"
+  "CMakeFiles/core.dir/piecewiselinfunction.C.o"
+  "CMakeFiles/core.dir/piecewiselinfunction.C.o.d"
+  "CMakeFiles/core.dir/pointload.C.o"
+  "CMakeFiles/core.dir/pointload.C.o.d"
+  "CMakeFiles/core.dir/prescribedgradient.C.o"
+  "CMakeFiles/core.dir/prescribedgradient.C.o.d"
+  "CMakeFiles/core.dir/primaryfield.C.o"
+  "CMakeFiles/core.dir/primaryfield.C.o.d"
+  "CMakeFiles/core.dir/primaryunknownmapper.C.o"
+  "CMakeFiles/core.dir/primaryunknownmapper.C.o.d"
+  "CMakeFiles/core.dir/problemcomm.C.o"
+  "CMakeFiles/core.dir/problemcomm.C.o.d"
+  "CMakeFiles/core.dir/processcomm.C.o"
+  "CMakeFiles/core.dir/processcomm.C.o.d"
+  "CMakeFiles/core.dir/randommaterialext.C.o"
+  "CMakeFiles/core.dir/randommaterialext.C.o.d"
+  "CMakeFiles/core.dir/reinforcement.C.o"
+  "CMakeFiles/core.dir/reinforcement.C.o.d"
+  "CMakeFiles/core.dir/remeshingcrit.C.o"
+  "CMakeFiles/core.dir/remeshingcrit.C.o.d"
+  "CMakeFiles/core.dir/rigidarmnode.C.o"
+  "CMakeFiles/core.dir/rigidarmnode.C.o.d"
+  "CMakeFiles/core.dir/rowcol.C.o"
+  "CMakeFiles/core.dir/rowcol.C.o.d"
+  "CMakeFiles/core.dir/rvematerial.C.o"
+  "CMakeFiles/core.dir/rvematerial.C.o.d"
+  "CMakeFiles/core.dir/set.C.o"
+  "CMakeFiles/core.dir/set.C.o.d"
+  "CMakeFiles/core.dir/simplecrosssection.C.o"
+  "CMakeFiles/core.dir/simplecrosssection.C.o.d"
+  "CMakeFiles/core.dir/simpleslavedof.C.o"
+  "CMakeFiles/core.dir/simpleslavedof.C.o.d"
+  "CMakeFiles/core.dir/skyline.C.o"
+  "CMakeFiles/core.dir/skyline.C.o.d"
+  "CMakeFiles/core.dir/skylineu.C.o"
+  "CMakeFiles/core.dir/skylineu.C.o.d"
+  "CMakeFiles/core.dir/slavedof.C.o"
+  "CMakeFiles/core.dir/slavedof.C.o.d"
+  "CMakeFiles/core.dir/slavenode.C.o"
+  "CMakeFiles/core.dir/slavenode.C.o.d"
+  "CMakeFiles/core.dir/sloangraph.C.o"
+  "CMakeFiles/core.dir/sloangraph.C.o.d"
+  "CMakeFiles/core.dir/sloangraphnode.C.o"
+  "CMakeFiles/core.dir/sloangraphnode.C.o.d"
+  "CMakeFiles/core.dir/sloanlevelstruct.C.o"
+  "CMakeFiles/core.dir/sloanlevelstruct.C.o.d"
+  "CMakeFiles/core.dir/smoothednodalintvarfield.C.o"
+  "CMakeFiles/core.dir/smoothednodalintvarfield.C.o.d"
+  "CMakeFiles/core.dir/solutionbasedshapefunction.C.o"
+  "CMakeFiles/core.dir/solutionbasedshapefunction.C.o.d"
+  "CMakeFiles/core.dir/sparselinsystemnm.C.o"
+  "CMakeFiles/core.dir/sparselinsystemnm.C.o.d"
+  "CMakeFiles/core.dir/spatiallocalizer.C.o"
+  "CMakeFiles/core.dir/spatiallocalizer.C.o.d"
+  "CMakeFiles/core.dir/sprnodalrecoverymodel.C.o"
+  "CMakeFiles/core.dir/sprnodalrecoverymodel.C.o.d"
+  "CMakeFiles/core.dir/staggeredproblem.C.o"
+  "CMakeFiles/core.dir/staggeredproblem.C.o.d"
+  "CMakeFiles/core.dir/statusarena.C.o"
+  "CMakeFiles/core.dir/statusarena.C.o.d"
+  "CMakeFiles/core.dir/strainvector.C.o"
+  "CMakeFiles/core.dir/strainvector.C.o.d"
+  "CMakeFiles/core.dir/stressstrainbasevector.C.o"
+  "CMakeFiles/core.dir/stressstrainbasevector.C.o.d"
+  "CMakeFiles/core.dir/stressvector.C.o"
+  "CMakeFiles/core.dir/stressvector.C.o.d"
+  "CMakeFiles/core.dir/subdivision.C.o"
+  "CMakeFiles/core.dir/subdivision.C.o.d"
+  "CMakeFiles/core.dir/subspaceit.C.o"
+  "CMakeFiles/core.dir/subspaceit.C.o.d"
+  "CMakeFiles/core.dir/surfacetensionbc.C.o"
+  "CMakeFiles/core.dir/surfacetensionbc.C.o.d"
+  "CMakeFiles/core.dir/t3dinterface.C.o"
+  "CMakeFiles/core.dir/t3dinterface.C.o.d"
+  "CMakeFiles/core.dir/targe2interface.C.o"
+  "CMakeFiles/core.dir/targe2interface.C.o.d"
+  "CMakeFiles/core.dir/timer.C.o"
+  "CMakeFiles/core.dir/timer.C.o.d"
+  "CMakeFiles/core.dir/timestep.C.o"
+  "CMakeFiles/core.dir/timestep.C.o.d"
+  "CMakeFiles/core.dir/tokenizer.C.o"
+  "CMakeFiles/core.dir/tokenizer.C.o.d"
+  "CMakeFiles/core.dir/trianglemesherinterface.C.o"
+  "CMakeFiles/core.dir/trianglemesherinterface.C.o.d"
+  "CMakeFiles/core.dir/userdefinedloadtimefunction.C.o"
+  "CMakeFiles/core.dir/userdefinedloadtimefunction.C.o.d"
+  "CMakeFiles/core.dir/util.C.o"
+  "CMakeFiles/core.dir/util.C.o.d"
+  "CMakeFiles/core.dir/vtkexportmodule.C.o"
+  "CMakeFiles/core.dir/vtkexportmodule.C.o.d"
+  "CMakeFiles/core.dir/vtkxmlexportmodule.C.o"
+  "CMakeFiles/core.dir/vtkxmlexportmodule.C.o.d"
+  "CMakeFiles/core.dir/vtkxmlwriter.C.o"
+  "CMakeFiles/core.dir/vtkxmlwriter.C.o.d"
+  "CMakeFiles/core.dir/weakperiodicbc.C.o"
+  "CMakeFiles/core.dir/weakperiodicbc.C.o.d"
+  "CMakeFiles/core.dir/xfem/XFEMDebugTools.C.o"
+  "CMakeFiles/core.dir/xfem/XFEMDebugTools.C.o.d"
+  "CMakeFiles/core.dir/xfem/delaunay.C.o"
+  "CMakeFiles/core.dir/xfem/delaunay.C.o.d"
+  "CMakeFiles/core.dir/xfem/enrichmentdomain.C.o"
+  "CMakeFiles/core.dir/xfem/enrichmentdomain.C.o.d"
+  "CMakeFiles/core.dir/xfem/enrichmentfunction.C.o"
+  "CMakeFiles/core.dir/xfem/enrichmentfunction.C.o.d"
+  "CMakeFiles/core.dir/xfem/enrichmentitem.C.o"
+  "CMakeFiles/core.dir/xfem/enrichmentitem.C.o.d"
+  "CMakeFiles/core.dir/xfem/patch.C.o"
+  "CMakeFiles/core.dir/xfem/patch.C.o.d"
+  "CMakeFiles/core.dir/xfem/patchintegrationrule.C.o"
+  "CMakeFiles/core.dir/xfem/patchintegrationrule.C.o.d"
+  "CMakeFiles/core.dir/xfem/propagationlaw.C.o"
+  "CMakeFiles/core.dir/xfem/propagationlaw.C.o.d"
+  "CMakeFiles/core.dir/xfem/xfemelementinterface.C.o"
+  "CMakeFiles/core.dir/xfem/xfemelementinterface.C.o.d"
+  "CMakeFiles/core.dir/xfem/xfemmanager.C.o"
+  "CMakeFiles/core.dir/xfem/xfemmanager.C.o.d"
+  "CMakeFiles/core.dir/zznodalrecoverymodel.C.o"
+  "CMakeFiles/core.dir/zznodalrecoverymodel.C.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/core.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
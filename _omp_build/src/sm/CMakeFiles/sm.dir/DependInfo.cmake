@@ -0,0 +1,210 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/sm/abaqususermaterial.C" "src/sm/CMakeFiles/sm.dir/abaqususermaterial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/abaqususermaterial.C.o.d"
+  "/root/repo/src/sm/adaptlinearstatic.C" "src/sm/CMakeFiles/sm.dir/adaptlinearstatic.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/adaptlinearstatic.C.o.d"
+  "/root/repo/src/sm/adaptnlinearstatic.C" "src/sm/CMakeFiles/sm.dir/adaptnlinearstatic.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/adaptnlinearstatic.C.o.d"
+  "/root/repo/src/sm/axisymm3d.C" "src/sm/CMakeFiles/sm.dir/axisymm3d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/axisymm3d.C.o.d"
+  "/root/repo/src/sm/b3mat.C" "src/sm/CMakeFiles/sm.dir/b3mat.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/b3mat.C.o.d"
+  "/root/repo/src/sm/b3solidmat.C" "src/sm/CMakeFiles/sm.dir/b3solidmat.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/b3solidmat.C.o.d"
+  "/root/repo/src/sm/beam2d.C" "src/sm/CMakeFiles/sm.dir/beam2d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/beam2d.C.o.d"
+  "/root/repo/src/sm/beam3d.C" "src/sm/CMakeFiles/sm.dir/beam3d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/beam3d.C.o.d"
+  "/root/repo/src/sm/bilinearczmaterial.C" "src/sm/CMakeFiles/sm.dir/bilinearczmaterial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/bilinearczmaterial.C.o.d"
+  "/root/repo/src/sm/cct.C" "src/sm/CMakeFiles/sm.dir/cct.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/cct.C.o.d"
+  "/root/repo/src/sm/cct3d.C" "src/sm/CMakeFiles/sm.dir/cct3d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/cct3d.C.o.d"
+  "/root/repo/src/sm/cebfip78.C" "src/sm/CMakeFiles/sm.dir/cebfip78.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/cebfip78.C.o.d"
+  "/root/repo/src/sm/cohint.C" "src/sm/CMakeFiles/sm.dir/cohint.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/cohint.C.o.d"
+  "/root/repo/src/sm/cohsur3d.C" "src/sm/CMakeFiles/sm.dir/cohsur3d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/cohsur3d.C.o.d"
+  "/root/repo/src/sm/combinedzzsiee.C" "src/sm/CMakeFiles/sm.dir/combinedzzsiee.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/combinedzzsiee.C.o.d"
+  "/root/repo/src/sm/compodamagemat.C" "src/sm/CMakeFiles/sm.dir/compodamagemat.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/compodamagemat.C.o.d"
+  "/root/repo/src/sm/concrete2.C" "src/sm/CMakeFiles/sm.dir/concrete2.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/concrete2.C.o.d"
+  "/root/repo/src/sm/concrete3.C" "src/sm/CMakeFiles/sm.dir/concrete3.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/concrete3.C.o.d"
+  "/root/repo/src/sm/concretedpm.C" "src/sm/CMakeFiles/sm.dir/concretedpm.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/concretedpm.C.o.d"
+  "/root/repo/src/sm/concretedpm2.C" "src/sm/CMakeFiles/sm.dir/concretedpm2.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/concretedpm2.C.o.d"
+  "/root/repo/src/sm/constantpressureload.C" "src/sm/CMakeFiles/sm.dir/constantpressureload.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/constantpressureload.C.o.d"
+  "/root/repo/src/sm/deformationtheorymaterial.C" "src/sm/CMakeFiles/sm.dir/deformationtheorymaterial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/deformationtheorymaterial.C.o.d"
+  "/root/repo/src/sm/deidynamic.C" "src/sm/CMakeFiles/sm.dir/deidynamic.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/deidynamic.C.o.d"
+  "/root/repo/src/sm/diidynamic.C" "src/sm/CMakeFiles/sm.dir/diidynamic.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/diidynamic.C.o.d"
+  "/root/repo/src/sm/directerrorindicatorrc.C" "src/sm/CMakeFiles/sm.dir/directerrorindicatorrc.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/directerrorindicatorrc.C.o.d"
+  "/root/repo/src/sm/dmexportmodule.C" "src/sm/CMakeFiles/sm.dir/dmexportmodule.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/dmexportmodule.C.o.d"
+  "/root/repo/src/sm/doublepowerlaw.C" "src/sm/CMakeFiles/sm.dir/doublepowerlaw.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/doublepowerlaw.C.o.d"
+  "/root/repo/src/sm/druckerPragerPlasticitySM.C" "src/sm/CMakeFiles/sm.dir/druckerPragerPlasticitySM.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/druckerPragerPlasticitySM.C.o.d"
+  "/root/repo/src/sm/druckerpragercutmat.C" "src/sm/CMakeFiles/sm.dir/druckerpragercutmat.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/druckerpragercutmat.C.o.d"
+  "/root/repo/src/sm/dustmat.C" "src/sm/CMakeFiles/sm.dir/dustmat.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/dustmat.C.o.d"
+  "/root/repo/src/sm/eigenvaluedynamic.C" "src/sm/CMakeFiles/sm.dir/eigenvaluedynamic.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/eigenvaluedynamic.C.o.d"
+  "/root/repo/src/sm/fetiboundarydofman.C" "src/sm/CMakeFiles/sm.dir/fetiboundarydofman.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/fetiboundarydofman.C.o.d"
+  "/root/repo/src/sm/feticommunicator.C" "src/sm/CMakeFiles/sm.dir/feticommunicator.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/feticommunicator.C.o.d"
+  "/root/repo/src/sm/fetisolver.C" "src/sm/CMakeFiles/sm.dir/fetisolver.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/fetisolver.C.o.d"
+  "/root/repo/src/sm/fiberedcs.C" "src/sm/CMakeFiles/sm.dir/fiberedcs.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/fiberedcs.C.o.d"
+  "/root/repo/src/sm/fracturemanager.C" "src/sm/CMakeFiles/sm.dir/fracturemanager.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/fracturemanager.C.o.d"
+  "/root/repo/src/sm/gpinitmodule.C" "src/sm/CMakeFiles/sm.dir/gpinitmodule.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/gpinitmodule.C.o.d"
+  "/root/repo/src/sm/graddpelement.C" "src/sm/CMakeFiles/sm.dir/graddpelement.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/graddpelement.C.o.d"
+  "/root/repo/src/sm/graddpmaterialextensioninterface.C" "src/sm/CMakeFiles/sm.dir/graddpmaterialextensioninterface.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/graddpmaterialextensioninterface.C.o.d"
+  "/root/repo/src/sm/hellmat.C" "src/sm/CMakeFiles/sm.dir/hellmat.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/hellmat.C.o.d"
+  "/root/repo/src/sm/htselement.C" "src/sm/CMakeFiles/sm.dir/htselement.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/htselement.C.o.d"
+  "/root/repo/src/sm/huertaerrorestimator.C" "src/sm/CMakeFiles/sm.dir/huertaerrorestimator.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/huertaerrorestimator.C.o.d"
+  "/root/repo/src/sm/hydram.C" "src/sm/CMakeFiles/sm.dir/hydram.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/hydram.C.o.d"
+  "/root/repo/src/sm/hyperelasticmaterial.C" "src/sm/CMakeFiles/sm.dir/hyperelasticmaterial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/hyperelasticmaterial.C.o.d"
+  "/root/repo/src/sm/idm1.C" "src/sm/CMakeFiles/sm.dir/idm1.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/idm1.C.o.d"
+  "/root/repo/src/sm/idmgrad1.C" "src/sm/CMakeFiles/sm.dir/idmgrad1.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/idmgrad1.C.o.d"
+  "/root/repo/src/sm/idmnl1.C" "src/sm/CMakeFiles/sm.dir/idmnl1.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/idmnl1.C.o.d"
+  "/root/repo/src/sm/igaelements.C" "src/sm/CMakeFiles/sm.dir/igaelements.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/igaelements.C.o.d"
+  "/root/repo/src/sm/incrementallinearstatic.C" "src/sm/CMakeFiles/sm.dir/incrementallinearstatic.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/incrementallinearstatic.C.o.d"
+  "/root/repo/src/sm/interfaceelem2dquad.C" "src/sm/CMakeFiles/sm.dir/interfaceelem2dquad.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/interfaceelem2dquad.C.o.d"
+  "/root/repo/src/sm/interfaceelem3dtrlin.C" "src/sm/CMakeFiles/sm.dir/interfaceelem3dtrlin.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/interfaceelem3dtrlin.C.o.d"
+  "/root/repo/src/sm/interfaceelement1d.C" "src/sm/CMakeFiles/sm.dir/interfaceelement1d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/interfaceelement1d.C.o.d"
+  "/root/repo/src/sm/intmatbilinczfagerstrom.C" "src/sm/CMakeFiles/sm.dir/intmatbilinczfagerstrom.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/intmatbilinczfagerstrom.C.o.d"
+  "/root/repo/src/sm/isodamagemodel.C" "src/sm/CMakeFiles/sm.dir/isodamagemodel.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/isodamagemodel.C.o.d"
+  "/root/repo/src/sm/isointerfacedamage01.C" "src/sm/CMakeFiles/sm.dir/isointerfacedamage01.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/isointerfacedamage01.C.o.d"
+  "/root/repo/src/sm/isointerfacedamage02.C" "src/sm/CMakeFiles/sm.dir/isointerfacedamage02.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/isointerfacedamage02.C.o.d"
+  "/root/repo/src/sm/isolinearelasticmaterial.C" "src/sm/CMakeFiles/sm.dir/isolinearelasticmaterial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/isolinearelasticmaterial.C.o.d"
+  "/root/repo/src/sm/j2mat.C" "src/sm/CMakeFiles/sm.dir/j2mat.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/j2mat.C.o.d"
+  "/root/repo/src/sm/j2mplasticmaterial.C" "src/sm/CMakeFiles/sm.dir/j2mplasticmaterial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/j2mplasticmaterial.C.o.d"
+  "/root/repo/src/sm/j2plasticmaterial.C" "src/sm/CMakeFiles/sm.dir/j2plasticmaterial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/j2plasticmaterial.C.o.d"
+  "/root/repo/src/sm/kelvinChM.C" "src/sm/CMakeFiles/sm.dir/kelvinChM.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/kelvinChM.C.o.d"
+  "/root/repo/src/sm/kelvinChSolM.C" "src/sm/CMakeFiles/sm.dir/kelvinChSolM.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/kelvinChSolM.C.o.d"
+  "/root/repo/src/sm/l4axisymm.C" "src/sm/CMakeFiles/sm.dir/l4axisymm.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/l4axisymm.C.o.d"
+  "/root/repo/src/sm/lattice2d.C" "src/sm/CMakeFiles/sm.dir/lattice2d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/lattice2d.C.o.d"
+  "/root/repo/src/sm/latticedamage2d.C" "src/sm/CMakeFiles/sm.dir/latticedamage2d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/latticedamage2d.C.o.d"
+  "/root/repo/src/sm/latticematstatus.C" "src/sm/CMakeFiles/sm.dir/latticematstatus.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/latticematstatus.C.o.d"
+  "/root/repo/src/sm/latticestructuralelement.C" "src/sm/CMakeFiles/sm.dir/latticestructuralelement.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/latticestructuralelement.C.o.d"
+  "/root/repo/src/sm/layeredcrosssection.C" "src/sm/CMakeFiles/sm.dir/layeredcrosssection.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/layeredcrosssection.C.o.d"
+  "/root/repo/src/sm/libeam2d.C" "src/sm/CMakeFiles/sm.dir/libeam2d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/libeam2d.C.o.d"
+  "/root/repo/src/sm/libeam2dnl.C" "src/sm/CMakeFiles/sm.dir/libeam2dnl.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/libeam2dnl.C.o.d"
+  "/root/repo/src/sm/libeam3d.C" "src/sm/CMakeFiles/sm.dir/libeam3d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/libeam3d.C.o.d"
+  "/root/repo/src/sm/libeam3d2.C" "src/sm/CMakeFiles/sm.dir/libeam3d2.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/libeam3d2.C.o.d"
+  "/root/repo/src/sm/libeam3dnl.C" "src/sm/CMakeFiles/sm.dir/libeam3dnl.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/libeam3dnl.C.o.d"
+  "/root/repo/src/sm/libeam3dnl2.C" "src/sm/CMakeFiles/sm.dir/libeam3dnl2.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/libeam3dnl2.C.o.d"
+  "/root/repo/src/sm/linearelasticmaterial.C" "src/sm/CMakeFiles/sm.dir/linearelasticmaterial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/linearelasticmaterial.C.o.d"
+  "/root/repo/src/sm/linearstability.C" "src/sm/CMakeFiles/sm.dir/linearstability.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/linearstability.C.o.d"
+  "/root/repo/src/sm/linearstatic.C" "src/sm/CMakeFiles/sm.dir/linearstatic.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/linearstatic.C.o.d"
+  "/root/repo/src/sm/lsmastermat.C" "src/sm/CMakeFiles/sm.dir/lsmastermat.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/lsmastermat.C.o.d"
+  "/root/repo/src/sm/lsmastermatgrad.C" "src/sm/CMakeFiles/sm.dir/lsmastermatgrad.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/lsmastermatgrad.C.o.d"
+  "/root/repo/src/sm/lspace.C" "src/sm/CMakeFiles/sm.dir/lspace.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/lspace.C.o.d"
+  "/root/repo/src/sm/lspacebb.C" "src/sm/CMakeFiles/sm.dir/lspacebb.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/lspacebb.C.o.d"
+  "/root/repo/src/sm/ltrspace.C" "src/sm/CMakeFiles/sm.dir/ltrspace.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/ltrspace.C.o.d"
+  "/root/repo/src/sm/lumpedmasselement.C" "src/sm/CMakeFiles/sm.dir/lumpedmasselement.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/lumpedmasselement.C.o.d"
+  "/root/repo/src/sm/lwedge.C" "src/sm/CMakeFiles/sm.dir/lwedge.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/lwedge.C.o.d"
+  "/root/repo/src/sm/m4.C" "src/sm/CMakeFiles/sm.dir/m4.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/m4.C.o.d"
+  "/root/repo/src/sm/macrolspace.C" "src/sm/CMakeFiles/sm.dir/macrolspace.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/macrolspace.C.o.d"
+  "/root/repo/src/sm/masonry02.C" "src/sm/CMakeFiles/sm.dir/masonry02.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/masonry02.C.o.d"
+  "/root/repo/src/sm/mat_cebfip90.C" "src/sm/CMakeFiles/sm.dir/mat_cebfip90.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/mat_cebfip90.C.o.d"
+  "/root/repo/src/sm/maxwellChM.C" "src/sm/CMakeFiles/sm.dir/maxwellChM.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/maxwellChM.C.o.d"
+  "/root/repo/src/sm/mazarsmodel.C" "src/sm/CMakeFiles/sm.dir/mazarsmodel.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/mazarsmodel.C.o.d"
+  "/root/repo/src/sm/mazarsmodelnl.C" "src/sm/CMakeFiles/sm.dir/mazarsmodelnl.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/mazarsmodelnl.C.o.d"
+  "/root/repo/src/sm/mdm.C" "src/sm/CMakeFiles/sm.dir/mdm.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/mdm.C.o.d"
+  "/root/repo/src/sm/micromaterial.C" "src/sm/CMakeFiles/sm.dir/micromaterial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/micromaterial.C.o.d"
+  "/root/repo/src/sm/microplane.C" "src/sm/CMakeFiles/sm.dir/microplane.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/microplane.C.o.d"
+  "/root/repo/src/sm/microplanematerial.C" "src/sm/CMakeFiles/sm.dir/microplanematerial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/microplanematerial.C.o.d"
+  "/root/repo/src/sm/microplanematerial_bazant.C" "src/sm/CMakeFiles/sm.dir/microplanematerial_bazant.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/microplanematerial_bazant.C.o.d"
+  "/root/repo/src/sm/misesmat.C" "src/sm/CMakeFiles/sm.dir/misesmat.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/misesmat.C.o.d"
+  "/root/repo/src/sm/misesmatgrad.C" "src/sm/CMakeFiles/sm.dir/misesmatgrad.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/misesmatgrad.C.o.d"
+  "/root/repo/src/sm/misesmatnl.C" "src/sm/CMakeFiles/sm.dir/misesmatnl.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/misesmatnl.C.o.d"
+  "/root/repo/src/sm/mplasticmaterial.C" "src/sm/CMakeFiles/sm.dir/mplasticmaterial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/mplasticmaterial.C.o.d"
+  "/root/repo/src/sm/mplasticmaterial2.C" "src/sm/CMakeFiles/sm.dir/mplasticmaterial2.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/mplasticmaterial2.C.o.d"
+  "/root/repo/src/sm/mps.C" "src/sm/CMakeFiles/sm.dir/mps.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/mps.C.o.d"
+  "/root/repo/src/sm/nldeidynamic.C" "src/sm/CMakeFiles/sm.dir/nldeidynamic.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/nldeidynamic.C.o.d"
+  "/root/repo/src/sm/nlineardynamic.C" "src/sm/CMakeFiles/sm.dir/nlineardynamic.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/nlineardynamic.C.o.d"
+  "/root/repo/src/sm/nlinearstatic.C" "src/sm/CMakeFiles/sm.dir/nlinearstatic.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/nlinearstatic.C.o.d"
+  "/root/repo/src/sm/nlstructuralelement.C" "src/sm/CMakeFiles/sm.dir/nlstructuralelement.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/nlstructuralelement.C.o.d"
+  "/root/repo/src/sm/ortholinearelasticmaterial.C" "src/sm/CMakeFiles/sm.dir/ortholinearelasticmaterial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/ortholinearelasticmaterial.C.o.d"
+  "/root/repo/src/sm/particle.C" "src/sm/CMakeFiles/sm.dir/particle.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/particle.C.o.d"
+  "/root/repo/src/sm/perfectlyplasticmaterial.C" "src/sm/CMakeFiles/sm.dir/perfectlyplasticmaterial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/perfectlyplasticmaterial.C.o.d"
+  "/root/repo/src/sm/planestresselementevaluator.C" "src/sm/CMakeFiles/sm.dir/planestresselementevaluator.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/planestresselementevaluator.C.o.d"
+  "/root/repo/src/sm/planstrss.C" "src/sm/CMakeFiles/sm.dir/planstrss.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/planstrss.C.o.d"
+  "/root/repo/src/sm/planstrssxfem.C" "src/sm/CMakeFiles/sm.dir/planstrssxfem.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/planstrssxfem.C.o.d"
+  "/root/repo/src/sm/plasticmaterial.C" "src/sm/CMakeFiles/sm.dir/plasticmaterial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/plasticmaterial.C.o.d"
+  "/root/repo/src/sm/poiexportmodule.C" "src/sm/CMakeFiles/sm.dir/poiexportmodule.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/poiexportmodule.C.o.d"
+  "/root/repo/src/sm/polylinenonlocalbarrier.C" "src/sm/CMakeFiles/sm.dir/polylinenonlocalbarrier.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/polylinenonlocalbarrier.C.o.d"
+  "/root/repo/src/sm/q27space.C" "src/sm/CMakeFiles/sm.dir/q27space.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/q27space.C.o.d"
+  "/root/repo/src/sm/q4axisymm.C" "src/sm/CMakeFiles/sm.dir/q4axisymm.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/q4axisymm.C.o.d"
+  "/root/repo/src/sm/q9planstrss.C" "src/sm/CMakeFiles/sm.dir/q9planstrss.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/q9planstrss.C.o.d"
+  "/root/repo/src/sm/qplanestrain.C" "src/sm/CMakeFiles/sm.dir/qplanestrain.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/qplanestrain.C.o.d"
+  "/root/repo/src/sm/qplanestraingrad.C" "src/sm/CMakeFiles/sm.dir/qplanestraingrad.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/qplanestraingrad.C.o.d"
+  "/root/repo/src/sm/qplanestressgrad.C" "src/sm/CMakeFiles/sm.dir/qplanestressgrad.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/qplanestressgrad.C.o.d"
+  "/root/repo/src/sm/qplanstrss.C" "src/sm/CMakeFiles/sm.dir/qplanstrss.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/qplanstrss.C.o.d"
+  "/root/repo/src/sm/qspace.C" "src/sm/CMakeFiles/sm.dir/qspace.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/qspace.C.o.d"
+  "/root/repo/src/sm/qspacegrad.C" "src/sm/CMakeFiles/sm.dir/qspacegrad.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/qspacegrad.C.o.d"
+  "/root/repo/src/sm/qtrplanestrain.C" "src/sm/CMakeFiles/sm.dir/qtrplanestrain.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/qtrplanestrain.C.o.d"
+  "/root/repo/src/sm/qtrplanestraingrad.C" "src/sm/CMakeFiles/sm.dir/qtrplanestraingrad.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/qtrplanestraingrad.C.o.d"
+  "/root/repo/src/sm/qtrplstr.C" "src/sm/CMakeFiles/sm.dir/qtrplstr.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/qtrplstr.C.o.d"
+  "/root/repo/src/sm/qtrplstrgrad.C" "src/sm/CMakeFiles/sm.dir/qtrplstrgrad.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/qtrplstrgrad.C.o.d"
+  "/root/repo/src/sm/qtrspace.C" "src/sm/CMakeFiles/sm.dir/qtrspace.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/qtrspace.C.o.d"
+  "/root/repo/src/sm/qtrspacegrad.C" "src/sm/CMakeFiles/sm.dir/qtrspacegrad.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/qtrspacegrad.C.o.d"
+  "/root/repo/src/sm/qtruss1d.C" "src/sm/CMakeFiles/sm.dir/qtruss1d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/qtruss1d.C.o.d"
+  "/root/repo/src/sm/qtruss1dgrad.C" "src/sm/CMakeFiles/sm.dir/qtruss1dgrad.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/qtruss1dgrad.C.o.d"
+  "/root/repo/src/sm/quad1mindlin.C" "src/sm/CMakeFiles/sm.dir/quad1mindlin.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/quad1mindlin.C.o.d"
+  "/root/repo/src/sm/quad1mindlinshell3d.C" "src/sm/CMakeFiles/sm.dir/quad1mindlinshell3d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/quad1mindlinshell3d.C.o.d"
+  "/root/repo/src/sm/quad1planestrain.C" "src/sm/CMakeFiles/sm.dir/quad1planestrain.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/quad1planestrain.C.o.d"
+  "/root/repo/src/sm/qwedge.C" "src/sm/CMakeFiles/sm.dir/qwedge.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/qwedge.C.o.d"
+  "/root/repo/src/sm/qwedgegrad.C" "src/sm/CMakeFiles/sm.dir/qwedgegrad.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/qwedgegrad.C.o.d"
+  "/root/repo/src/sm/rankinemat.C" "src/sm/CMakeFiles/sm.dir/rankinemat.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/rankinemat.C.o.d"
+  "/root/repo/src/sm/rankinematgrad.C" "src/sm/CMakeFiles/sm.dir/rankinematgrad.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/rankinematgrad.C.o.d"
+  "/root/repo/src/sm/rankinematnl.C" "src/sm/CMakeFiles/sm.dir/rankinematnl.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/rankinematnl.C.o.d"
+  "/root/repo/src/sm/rankinepm.C" "src/sm/CMakeFiles/sm.dir/rankinepm.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/rankinepm.C.o.d"
+  "/root/repo/src/sm/rcm2.C" "src/sm/CMakeFiles/sm.dir/rcm2.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/rcm2.C.o.d"
+  "/root/repo/src/sm/rcsd.C" "src/sm/CMakeFiles/sm.dir/rcsd.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/rcsd.C.o.d"
+  "/root/repo/src/sm/rcsde.C" "src/sm/CMakeFiles/sm.dir/rcsde.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/rcsde.C.o.d"
+  "/root/repo/src/sm/rcsdnl.C" "src/sm/CMakeFiles/sm.dir/rcsdnl.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/rcsdnl.C.o.d"
+  "/root/repo/src/sm/refinedelement.C" "src/sm/CMakeFiles/sm.dir/refinedelement.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/refinedelement.C.o.d"
+  "/root/repo/src/sm/refinedmesh.C" "src/sm/CMakeFiles/sm.dir/refinedmesh.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/refinedmesh.C.o.d"
+  "/root/repo/src/sm/rershell.C" "src/sm/CMakeFiles/sm.dir/rershell.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/rershell.C.o.d"
+  "/root/repo/src/sm/rheoChM.C" "src/sm/CMakeFiles/sm.dir/rheoChM.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/rheoChM.C.o.d"
+  "/root/repo/src/sm/rotatingboundary.C" "src/sm/CMakeFiles/sm.dir/rotatingboundary.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/rotatingboundary.C.o.d"
+  "/root/repo/src/sm/scalarerrorindicator.C" "src/sm/CMakeFiles/sm.dir/scalarerrorindicator.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/scalarerrorindicator.C.o.d"
+  "/root/repo/src/sm/shell7base.C" "src/sm/CMakeFiles/sm.dir/shell7base.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/shell7base.C.o.d"
+  "/root/repo/src/sm/shell7basexfem.C" "src/sm/CMakeFiles/sm.dir/shell7basexfem.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/shell7basexfem.C.o.d"
+  "/root/repo/src/sm/simpleinterfacemat.C" "src/sm/CMakeFiles/sm.dir/simpleinterfacemat.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/simpleinterfacemat.C.o.d"
+  "/root/repo/src/sm/space3delementevaluator.C" "src/sm/CMakeFiles/sm.dir/space3delementevaluator.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/space3delementevaluator.C.o.d"
+  "/root/repo/src/sm/springelement.C" "src/sm/CMakeFiles/sm.dir/springelement.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/springelement.C.o.d"
+  "/root/repo/src/sm/staticfracture.C" "src/sm/CMakeFiles/sm.dir/staticfracture.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/staticfracture.C.o.d"
+  "/root/repo/src/sm/steel1.C" "src/sm/CMakeFiles/sm.dir/steel1.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/steel1.C.o.d"
+  "/root/repo/src/sm/structeigenstrainload.C" "src/sm/CMakeFiles/sm.dir/structeigenstrainload.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/structeigenstrainload.C.o.d"
+  "/root/repo/src/sm/structengngmodel.C" "src/sm/CMakeFiles/sm.dir/structengngmodel.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/structengngmodel.C.o.d"
+  "/root/repo/src/sm/structtemperatureload.C" "src/sm/CMakeFiles/sm.dir/structtemperatureload.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/structtemperatureload.C.o.d"
+  "/root/repo/src/sm/structuralcrosssection.C" "src/sm/CMakeFiles/sm.dir/structuralcrosssection.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/structuralcrosssection.C.o.d"
+  "/root/repo/src/sm/structuralelement.C" "src/sm/CMakeFiles/sm.dir/structuralelement.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/structuralelement.C.o.d"
+  "/root/repo/src/sm/structuralelementevaluator.C" "src/sm/CMakeFiles/sm.dir/structuralelementevaluator.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/structuralelementevaluator.C.o.d"
+  "/root/repo/src/sm/structuralinterfacematerial.C" "src/sm/CMakeFiles/sm.dir/structuralinterfacematerial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/structuralinterfacematerial.C.o.d"
+  "/root/repo/src/sm/structuralinterfacematerialstatus.C" "src/sm/CMakeFiles/sm.dir/structuralinterfacematerialstatus.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/structuralinterfacematerialstatus.C.o.d"
+  "/root/repo/src/sm/structuralmaterial.C" "src/sm/CMakeFiles/sm.dir/structuralmaterial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/structuralmaterial.C.o.d"
+  "/root/repo/src/sm/structuralms.C" "src/sm/CMakeFiles/sm.dir/structuralms.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/structuralms.C.o.d"
+  "/root/repo/src/sm/symmetrybarrier.C" "src/sm/CMakeFiles/sm.dir/symmetrybarrier.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/symmetrybarrier.C.o.d"
+  "/root/repo/src/sm/tf1.C" "src/sm/CMakeFiles/sm.dir/tf1.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/tf1.C.o.d"
+  "/root/repo/src/sm/tr2shell7.C" "src/sm/CMakeFiles/sm.dir/tr2shell7.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/tr2shell7.C.o.d"
+  "/root/repo/src/sm/tr2shell7xfem.C" "src/sm/CMakeFiles/sm.dir/tr2shell7xfem.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/tr2shell7xfem.C.o.d"
+  "/root/repo/src/sm/tr_shell01.C" "src/sm/CMakeFiles/sm.dir/tr_shell01.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/tr_shell01.C.o.d"
+  "/root/repo/src/sm/trabbone3d.C" "src/sm/CMakeFiles/sm.dir/trabbone3d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/trabbone3d.C.o.d"
+  "/root/repo/src/sm/trabboneembed.C" "src/sm/CMakeFiles/sm.dir/trabboneembed.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/trabboneembed.C.o.d"
+  "/root/repo/src/sm/trabbonegrad3d.C" "src/sm/CMakeFiles/sm.dir/trabbonegrad3d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/trabbonegrad3d.C.o.d"
+  "/root/repo/src/sm/trabbonematerial.C" "src/sm/CMakeFiles/sm.dir/trabbonematerial.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/trabbonematerial.C.o.d"
+  "/root/repo/src/sm/trabbonenl.C" "src/sm/CMakeFiles/sm.dir/trabbonenl.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/trabbonenl.C.o.d"
+  "/root/repo/src/sm/trabbonenl3d.C" "src/sm/CMakeFiles/sm.dir/trabbonenl3d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/trabbonenl3d.C.o.d"
+  "/root/repo/src/sm/trabbonenlembed.C" "src/sm/CMakeFiles/sm.dir/trabbonenlembed.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/trabbonenlembed.C.o.d"
+  "/root/repo/src/sm/trplanestrain.C" "src/sm/CMakeFiles/sm.dir/trplanestrain.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/trplanestrain.C.o.d"
+  "/root/repo/src/sm/trplanestressrotallman.C" "src/sm/CMakeFiles/sm.dir/trplanestressrotallman.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/trplanestressrotallman.C.o.d"
+  "/root/repo/src/sm/trplanrot.C" "src/sm/CMakeFiles/sm.dir/trplanrot.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/trplanrot.C.o.d"
+  "/root/repo/src/sm/trplanrot3d.C" "src/sm/CMakeFiles/sm.dir/trplanrot3d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/trplanrot3d.C.o.d"
+  "/root/repo/src/sm/trplanstrss.C" "src/sm/CMakeFiles/sm.dir/trplanstrss.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/trplanstrss.C.o.d"
+  "/root/repo/src/sm/trplanstrssxfem.C" "src/sm/CMakeFiles/sm.dir/trplanstrssxfem.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/trplanstrssxfem.C.o.d"
+  "/root/repo/src/sm/truss1d.C" "src/sm/CMakeFiles/sm.dir/truss1d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/truss1d.C.o.d"
+  "/root/repo/src/sm/truss2d.C" "src/sm/CMakeFiles/sm.dir/truss2d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/truss2d.C.o.d"
+  "/root/repo/src/sm/truss3d.C" "src/sm/CMakeFiles/sm.dir/truss3d.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/truss3d.C.o.d"
+  "/root/repo/src/sm/usrdeftempfield.C" "src/sm/CMakeFiles/sm.dir/usrdeftempfield.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/usrdeftempfield.C.o.d"
+  "/root/repo/src/sm/xfemstatic.C" "src/sm/CMakeFiles/sm.dir/xfemstatic.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/xfemstatic.C.o.d"
+  "/root/repo/src/sm/zzerrorestimator.C" "src/sm/CMakeFiles/sm.dir/zzerrorestimator.C.o" "gcc" "src/sm/CMakeFiles/sm.dir/zzerrorestimator.C.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
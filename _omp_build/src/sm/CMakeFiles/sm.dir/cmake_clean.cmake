@@ -0,0 +1,391 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sm.dir/abaqususermaterial.C.o"
+  "CMakeFiles/sm.dir/abaqususermaterial.C.o.d"
+  "CMakeFiles/sm.dir/adaptlinearstatic.C.o"
+  "CMakeFiles/sm.dir/adaptlinearstatic.C.o.d"
+  "CMakeFiles/sm.dir/adaptnlinearstatic.C.o"
+  "CMakeFiles/sm.dir/adaptnlinearstatic.C.o.d"
+  "CMakeFiles/sm.dir/axisymm3d.C.o"
+  "CMakeFiles/sm.dir/axisymm3d.C.o.d"
+  "CMakeFiles/sm.dir/b3mat.C.o"
+  "CMakeFiles/sm.dir/b3mat.C.o.d"
+  "CMakeFiles/sm.dir/b3solidmat.C.o"
+  "CMakeFiles/sm.dir/b3solidmat.C.o.d"
+  "CMakeFiles/sm.dir/beam2d.C.o"
+  "CMakeFiles/sm.dir/beam2d.C.o.d"
+  "CMakeFiles/sm.dir/beam3d.C.o"
+  "CMakeFiles/sm.dir/beam3d.C.o.d"
+  "CMakeFiles/sm.dir/bilinearczmaterial.C.o"
+  "CMakeFiles/sm.dir/bilinearczmaterial.C.o.d"
+  "CMakeFiles/sm.dir/cct.C.o"
+  "CMakeFiles/sm.dir/cct.C.o.d"
+  "CMakeFiles/sm.dir/cct3d.C.o"
+  "CMakeFiles/sm.dir/cct3d.C.o.d"
+  "CMakeFiles/sm.dir/cebfip78.C.o"
+  "CMakeFiles/sm.dir/cebfip78.C.o.d"
+  "CMakeFiles/sm.dir/cohint.C.o"
+  "CMakeFiles/sm.dir/cohint.C.o.d"
+  "CMakeFiles/sm.dir/cohsur3d.C.o"
+  "CMakeFiles/sm.dir/cohsur3d.C.o.d"
+  "CMakeFiles/sm.dir/combinedzzsiee.C.o"
+  "CMakeFiles/sm.dir/combinedzzsiee.C.o.d"
+  "CMakeFiles/sm.dir/compodamagemat.C.o"
+  "CMakeFiles/sm.dir/compodamagemat.C.o.d"
+  "CMakeFiles/sm.dir/concrete2.C.o"
+  "CMakeFiles/sm.dir/concrete2.C.o.d"
+  "CMakeFiles/sm.dir/concrete3.C.o"
+  "CMakeFiles/sm.dir/concrete3.C.o.d"
+  "CMakeFiles/sm.dir/concretedpm.C.o"
+  "CMakeFiles/sm.dir/concretedpm.C.o.d"
+  "CMakeFiles/sm.dir/concretedpm2.C.o"
+  "CMakeFiles/sm.dir/concretedpm2.C.o.d"
+  "CMakeFiles/sm.dir/constantpressureload.C.o"
+  "CMakeFiles/sm.dir/constantpressureload.C.o.d"
+  "CMakeFiles/sm.dir/deformationtheorymaterial.C.o"
+  "CMakeFiles/sm.dir/deformationtheorymaterial.C.o.d"
+  "CMakeFiles/sm.dir/deidynamic.C.o"
+  "CMakeFiles/sm.dir/deidynamic.C.o.d"
+  "CMakeFiles/sm.dir/diidynamic.C.o"
+  "CMakeFiles/sm.dir/diidynamic.C.o.d"
+  "CMakeFiles/sm.dir/directerrorindicatorrc.C.o"
+  "CMakeFiles/sm.dir/directerrorindicatorrc.C.o.d"
+  "CMakeFiles/sm.dir/dmexportmodule.C.o"
+  "CMakeFiles/sm.dir/dmexportmodule.C.o.d"
+  "CMakeFiles/sm.dir/doublepowerlaw.C.o"
+  "CMakeFiles/sm.dir/doublepowerlaw.C.o.d"
+  "CMakeFiles/sm.dir/druckerPragerPlasticitySM.C.o"
+  "CMakeFiles/sm.dir/druckerPragerPlasticitySM.C.o.d"
+  "CMakeFiles/sm.dir/druckerpragercutmat.C.o"
+  "CMakeFiles/sm.dir/druckerpragercutmat.C.o.d"
+  "CMakeFiles/sm.dir/dustmat.C.o"
+  "CMakeFiles/sm.dir/dustmat.C.o.d"
+  "CMakeFiles/sm.dir/eigenvaluedynamic.C.o"
+  "CMakeFiles/sm.dir/eigenvaluedynamic.C.o.d"
+  "CMakeFiles/sm.dir/fetiboundarydofman.C.o"
+  "CMakeFiles/sm.dir/fetiboundarydofman.C.o.d"
+  "CMakeFiles/sm.dir/feticommunicator.C.o"
+  "CMakeFiles/sm.dir/feticommunicator.C.o.d"
+  "CMakeFiles/sm.dir/fetisolver.C.o"
+  "CMakeFiles/sm.dir/fetisolver.C.o.d"
+  "CMakeFiles/sm.dir/fiberedcs.C.o"
+  "CMakeFiles/sm.dir/fiberedcs.C.o.d"
+  "CMakeFiles/sm.dir/fracturemanager.C.o"
+  "CMakeFiles/sm.dir/fracturemanager.C.o.d"
+  "CMakeFiles/sm.dir/gpinitmodule.C.o"
+  "CMakeFiles/sm.dir/gpinitmodule.C.o.d"
+  "CMakeFiles/sm.dir/graddpelement.C.o"
+  "CMakeFiles/sm.dir/graddpelement.C.o.d"
+  "CMakeFiles/sm.dir/graddpmaterialextensioninterface.C.o"
+  "CMakeFiles/sm.dir/graddpmaterialextensioninterface.C.o.d"
+  "CMakeFiles/sm.dir/hellmat.C.o"
+  "CMakeFiles/sm.dir/hellmat.C.o.d"
+  "CMakeFiles/sm.dir/htselement.C.o"
+  "CMakeFiles/sm.dir/htselement.C.o.d"
+  "CMakeFiles/sm.dir/huertaerrorestimator.C.o"
+  "CMakeFiles/sm.dir/huertaerrorestimator.C.o.d"
+  "CMakeFiles/sm.dir/hydram.C.o"
+  "CMakeFiles/sm.dir/hydram.C.o.d"
+  "CMakeFiles/sm.dir/hyperelasticmaterial.C.o"
+  "CMakeFiles/sm.dir/hyperelasticmaterial.C.o.d"
+  "CMakeFiles/sm.dir/idm1.C.o"
+  "CMakeFiles/sm.dir/idm1.C.o.d"
+  "CMakeFiles/sm.dir/idmgrad1.C.o"
+  "CMakeFiles/sm.dir/idmgrad1.C.o.d"
+  "CMakeFiles/sm.dir/idmnl1.C.o"
+  "CMakeFiles/sm.dir/idmnl1.C.o.d"
+  "CMakeFiles/sm.dir/igaelements.C.o"
+  "CMakeFiles/sm.dir/igaelements.C.o.d"
+  "CMakeFiles/sm.dir/incrementallinearstatic.C.o"
+  "CMakeFiles/sm.dir/incrementallinearstatic.C.o.d"
+  "CMakeFiles/sm.dir/interfaceelem2dquad.C.o"
+  "CMakeFiles/sm.dir/interfaceelem2dquad.C.o.d"
+  "CMakeFiles/sm.dir/interfaceelem3dtrlin.C.o"
+  "CMakeFiles/sm.dir/interfaceelem3dtrlin.C.o.d"
+  "CMakeFiles/sm.dir/interfaceelement1d.C.o"
+  "CMakeFiles/sm.dir/interfaceelement1d.C.o.d"
+  "CMakeFiles/sm.dir/intmatbilinczfagerstrom.C.o"
+  "CMakeFiles/sm.dir/intmatbilinczfagerstrom.C.o.d"
+  "CMakeFiles/sm.dir/isodamagemodel.C.o"
+  "CMakeFiles/sm.dir/isodamagemodel.C.o.d"
+  "CMakeFiles/sm.dir/isointerfacedamage01.C.o"
+  "CMakeFiles/sm.dir/isointerfacedamage01.C.o.d"
+  "CMakeFiles/sm.dir/isointerfacedamage02.C.o"
+  "CMakeFiles/sm.dir/isointerfacedamage02.C.o.d"
+  "CMakeFiles/sm.dir/isolinearelasticmaterial.C.o"
+  "CMakeFiles/sm.dir/isolinearelasticmaterial.C.o.d"
+  "CMakeFiles/sm.dir/j2mat.C.o"
+  "CMakeFiles/sm.dir/j2mat.C.o.d"
+  "CMakeFiles/sm.dir/j2mplasticmaterial.C.o"
+  "CMakeFiles/sm.dir/j2mplasticmaterial.C.o.d"
+  "CMakeFiles/sm.dir/j2plasticmaterial.C.o"
+  "CMakeFiles/sm.dir/j2plasticmaterial.C.o.d"
+  "CMakeFiles/sm.dir/kelvinChM.C.o"
+  "CMakeFiles/sm.dir/kelvinChM.C.o.d"
+  "CMakeFiles/sm.dir/kelvinChSolM.C.o"
+  "CMakeFiles/sm.dir/kelvinChSolM.C.o.d"
+  "CMakeFiles/sm.dir/l4axisymm.C.o"
+  "CMakeFiles/sm.dir/l4axisymm.C.o.d"
+  "CMakeFiles/sm.dir/lattice2d.C.o"
+  "CMakeFiles/sm.dir/lattice2d.C.o.d"
+  "CMakeFiles/sm.dir/latticedamage2d.C.o"
+  "CMakeFiles/sm.dir/latticedamage2d.C.o.d"
+  "CMakeFiles/sm.dir/latticematstatus.C.o"
+  "CMakeFiles/sm.dir/latticematstatus.C.o.d"
+  "CMakeFiles/sm.dir/latticestructuralelement.C.o"
+  "CMakeFiles/sm.dir/latticestructuralelement.C.o.d"
+  "CMakeFiles/sm.dir/layeredcrosssection.C.o"
+  "CMakeFiles/sm.dir/layeredcrosssection.C.o.d"
+  "CMakeFiles/sm.dir/libeam2d.C.o"
+  "CMakeFiles/sm.dir/libeam2d.C.o.d"
+  "CMakeFiles/sm.dir/libeam2dnl.C.o"
+  "CMakeFiles/sm.dir/libeam2dnl.C.o.d"
+  "CMakeFiles/sm.dir/libeam3d.C.o"
+  "CMakeFiles/sm.dir/libeam3d.C.o.d"
+  "CMakeFiles/sm.dir/libeam3d2.C.o"
+  "CMakeFiles/sm.dir/libeam3d2.C.o.d"
+  "CMakeFiles/sm.dir/libeam3dnl.C.o"
+  "CMakeFiles/sm.dir/libeam3dnl.C.o.d"
+  "CMakeFiles/sm.dir/libeam3dnl2.C.o"
+  "CMakeFiles/sm.dir/libeam3dnl2.C.o.d"
+  "CMakeFiles/sm.dir/linearelasticmaterial.C.o"
+  "CMakeFiles/sm.dir/linearelasticmaterial.C.o.d"
+  "CMakeFiles/sm.dir/linearstability.C.o"
+  "CMakeFiles/sm.dir/linearstability.C.o.d"
+  "CMakeFiles/sm.dir/linearstatic.C.o"
+  "CMakeFiles/sm.dir/linearstatic.C.o.d"
+  "CMakeFiles/sm.dir/lsmastermat.C.o"
+  "CMakeFiles/sm.dir/lsmastermat.C.o.d"
+  "CMakeFiles/sm.dir/lsmastermatgrad.C.o"
+  "CMakeFiles/sm.dir/lsmastermatgrad.C.o.d"
+  "CMakeFiles/sm.dir/lspace.C.o"
+  "CMakeFiles/sm.dir/lspace.C.o.d"
+  "CMakeFiles/sm.dir/lspacebb.C.o"
+  "CMakeFiles/sm.dir/lspacebb.C.o.d"
+  "CMakeFiles/sm.dir/ltrspace.C.o"
+  "CMakeFiles/sm.dir/ltrspace.C.o.d"
+  "CMakeFiles/sm.dir/lumpedmasselement.C.o"
+  "CMakeFiles/sm.dir/lumpedmasselement.C.o.d"
+  "CMakeFiles/sm.dir/lwedge.C.o"
+  "CMakeFiles/sm.dir/lwedge.C.o.d"
+  "CMakeFiles/sm.dir/m4.C.o"
+  "CMakeFiles/sm.dir/m4.C.o.d"
+  "CMakeFiles/sm.dir/macrolspace.C.o"
+  "CMakeFiles/sm.dir/macrolspace.C.o.d"
+  "CMakeFiles/sm.dir/masonry02.C.o"
+  "CMakeFiles/sm.dir/masonry02.C.o.d"
+  "CMakeFiles/sm.dir/mat_cebfip90.C.o"
+  "CMakeFiles/sm.dir/mat_cebfip90.C.o.d"
+  "CMakeFiles/sm.dir/maxwellChM.C.o"
+  "CMakeFiles/sm.dir/maxwellChM.C.o.d"
+  "CMakeFiles/sm.dir/mazarsmodel.C.o"
+  "CMakeFiles/sm.dir/mazarsmodel.C.o.d"
+  "CMakeFiles/sm.dir/mazarsmodelnl.C.o"
+  "CMakeFiles/sm.dir/mazarsmodelnl.C.o.d"
+  "CMakeFiles/sm.dir/mdm.C.o"
+  "CMakeFiles/sm.dir/mdm.C.o.d"
+  "CMakeFiles/sm.dir/micromaterial.C.o"
+  "CMakeFiles/sm.dir/micromaterial.C.o.d"
+  "CMakeFiles/sm.dir/microplane.C.o"
+  "CMakeFiles/sm.dir/microplane.C.o.d"
+  "CMakeFiles/sm.dir/microplanematerial.C.o"
+  "CMakeFiles/sm.dir/microplanematerial.C.o.d"
+  "CMakeFiles/sm.dir/microplanematerial_bazant.C.o"
+  "CMakeFiles/sm.dir/microplanematerial_bazant.C.o.d"
+  "CMakeFiles/sm.dir/misesmat.C.o"
+  "CMakeFiles/sm.dir/misesmat.C.o.d"
+  "CMakeFiles/sm.dir/misesmatgrad.C.o"
+  "CMakeFiles/sm.dir/misesmatgrad.C.o.d"
+  "CMakeFiles/sm.dir/misesmatnl.C.o"
+  "CMakeFiles/sm.dir/misesmatnl.C.o.d"
+  "CMakeFiles/sm.dir/mplasticmaterial.C.o"
+  "CMakeFiles/sm.dir/mplasticmaterial.C.o.d"
+  "CMakeFiles/sm.dir/mplasticmaterial2.C.o"
+  "CMakeFiles/sm.dir/mplasticmaterial2.C.o.d"
+  "CMakeFiles/sm.dir/mps.C.o"
+  "CMakeFiles/sm.dir/mps.C.o.d"
+  "CMakeFiles/sm.dir/nldeidynamic.C.o"
+  "CMakeFiles/sm.dir/nldeidynamic.C.o.d"
+  "CMakeFiles/sm.dir/nlineardynamic.C.o"
+  "CMakeFiles/sm.dir/nlineardynamic.C.o.d"
+  "CMakeFiles/sm.dir/nlinearstatic.C.o"
+  "CMakeFiles/sm.dir/nlinearstatic.C.o.d"
+  "CMakeFiles/sm.dir/nlstructuralelement.C.o"
+  "CMakeFiles/sm.dir/nlstructuralelement.C.o.d"
+  "CMakeFiles/sm.dir/ortholinearelasticmaterial.C.o"
+  "CMakeFiles/sm.dir/ortholinearelasticmaterial.C.o.d"
+  "CMakeFiles/sm.dir/particle.C.o"
+  "CMakeFiles/sm.dir/particle.C.o.d"
+  "CMakeFiles/sm.dir/perfectlyplasticmaterial.C.o"
+  "CMakeFiles/sm.dir/perfectlyplasticmaterial.C.o.d"
+  "CMakeFiles/sm.dir/planestresselementevaluator.C.o"
+  "CMakeFiles/sm.dir/planestresselementevaluator.C.o.d"
+  "CMakeFiles/sm.dir/planstrss.C.o"
+  "CMakeFiles/sm.dir/planstrss.C.o.d"
+  "CMakeFiles/sm.dir/planstrssxfem.C.o"
+  "CMakeFiles/sm.dir/planstrssxfem.C.o.d"
+  "CMakeFiles/sm.dir/plasticmaterial.C.o"
+  "CMakeFiles/sm.dir/plasticmaterial.C.o.d"
+  "CMakeFiles/sm.dir/poiexportmodule.C.o"
+  "CMakeFiles/sm.dir/poiexportmodule.C.o.d"
+  "CMakeFiles/sm.dir/polylinenonlocalbarrier.C.o"
+  "CMakeFiles/sm.dir/polylinenonlocalbarrier.C.o.d"
+  "CMakeFiles/sm.dir/q27space.C.o"
+  "CMakeFiles/sm.dir/q27space.C.o.d"
+  "CMakeFiles/sm.dir/q4axisymm.C.o"
+  "CMakeFiles/sm.dir/q4axisymm.C.o.d"
+  "CMakeFiles/sm.dir/q9planstrss.C.o"
+  "CMakeFiles/sm.dir/q9planstrss.C.o.d"
+  "CMakeFiles/sm.dir/qplanestrain.C.o"
+  "CMakeFiles/sm.dir/qplanestrain.C.o.d"
+  "CMakeFiles/sm.dir/qplanestraingrad.C.o"
+  "CMakeFiles/sm.dir/qplanestraingrad.C.o.d"
+  "CMakeFiles/sm.dir/qplanestressgrad.C.o"
+  "CMakeFiles/sm.dir/qplanestressgrad.C.o.d"
+  "CMakeFiles/sm.dir/qplanstrss.C.o"
+  "CMakeFiles/sm.dir/qplanstrss.C.o.d"
+  "CMakeFiles/sm.dir/qspace.C.o"
+  "CMakeFiles/sm.dir/qspace.C.o.d"
+  "CMakeFiles/sm.dir/qspacegrad.C.o"
+  "CMakeFiles/sm.dir/qspacegrad.C.o.d"
+  "CMakeFiles/sm.dir/qtrplanestrain.C.o"
+  "CMakeFiles/sm.dir/qtrplanestrain.C.o.d"
+  "CMakeFiles/sm.dir/qtrplanestraingrad.C.o"
+  "CMakeFiles/sm.dir/qtrplanestraingrad.C.o.d"
+  "CMakeFiles/sm.dir/qtrplstr.C.o"
+  "CMakeFiles/sm.dir/qtrplstr.C.o.d"
+  "CMakeFiles/sm.dir/qtrplstrgrad.C.o"
+  "CMakeFiles/sm.dir/qtrplstrgrad.C.o.d"
+  "CMakeFiles/sm.dir/qtrspace.C.o"
+  "CMakeFiles/sm.dir/qtrspace.C.o.d"
+  "CMakeFiles/sm.dir/qtrspacegrad.C.o"
+  "CMakeFiles/sm.dir/qtrspacegrad.C.o.d"
+  "CMakeFiles/sm.dir/qtruss1d.C.o"
+  "CMakeFiles/sm.dir/qtruss1d.C.o.d"
+  "CMakeFiles/sm.dir/qtruss1dgrad.C.o"
+  "CMakeFiles/sm.dir/qtruss1dgrad.C.o.d"
+  "CMakeFiles/sm.dir/quad1mindlin.C.o"
+  "CMakeFiles/sm.dir/quad1mindlin.C.o.d"
+  "CMakeFiles/sm.dir/quad1mindlinshell3d.C.o"
+  "CMakeFiles/sm.dir/quad1mindlinshell3d.C.o.d"
+  "CMakeFiles/sm.dir/quad1planestrain.C.o"
+  "CMakeFiles/sm.dir/quad1planestrain.C.o.d"
+  "CMakeFiles/sm.dir/qwedge.C.o"
+  "CMakeFiles/sm.dir/qwedge.C.o.d"
+  "CMakeFiles/sm.dir/qwedgegrad.C.o"
+  "CMakeFiles/sm.dir/qwedgegrad.C.o.d"
+  "CMakeFiles/sm.dir/rankinemat.C.o"
+  "CMakeFiles/sm.dir/rankinemat.C.o.d"
+  "CMakeFiles/sm.dir/rankinematgrad.C.o"
+  "CMakeFiles/sm.dir/rankinematgrad.C.o.d"
+  "CMakeFiles/sm.dir/rankinematnl.C.o"
+  "CMakeFiles/sm.dir/rankinematnl.C.o.d"
+  "CMakeFiles/sm.dir/rankinepm.C.o"
+  "CMakeFiles/sm.dir/rankinepm.C.o.d"
+  "CMakeFiles/sm.dir/rcm2.C.o"
+  "CMakeFiles/sm.dir/rcm2.C.o.d"
+  "CMakeFiles/sm.dir/rcsd.C.o"
+  "CMakeFiles/sm.dir/rcsd.C.o.d"
+  "CMakeFiles/sm.dir/rcsde.C.o"
+  "CMakeFiles/sm.dir/rcsde.C.o.d"
+  "CMakeFiles/sm.dir/rcsdnl.C.o"
+  "CMakeFiles/sm.dir/rcsdnl.C.o.d"
+  "CMakeFiles/sm.dir/refinedelement.C.o"
+  "CMakeFiles/sm.dir/refinedelement.C.o.d"
+  "CMakeFiles/sm.dir/refinedmesh.C.o"
+  "CMakeFiles/sm.dir/refinedmesh.C.o.d"
+  "CMakeFiles/sm.dir/rershell.C.o"
+  "CMakeFiles/sm.dir/rershell.C.o.d"
+  "CMakeFiles/sm.dir/rheoChM.C.o"
+  "CMakeFiles/sm.dir/rheoChM.C.o.d"
+  "CMakeFiles/sm.dir/rotatingboundary.C.o"
+  "CMakeFiles/sm.dir/rotatingboundary.C.o.d"
+  "CMakeFiles/sm.dir/scalarerrorindicator.C.o"
+  "CMakeFiles/sm.dir/scalarerrorindicator.C.o.d"
+  "CMakeFiles/sm.dir/shell7base.C.o"
+  "CMakeFiles/sm.dir/shell7base.C.o.d"
+  "CMakeFiles/sm.dir/shell7basexfem.C.o"
+  "CMakeFiles/sm.dir/shell7basexfem.C.o.d"
+  "CMakeFiles/sm.dir/simpleinterfacemat.C.o"
+  "CMakeFiles/sm.dir/simpleinterfacemat.C.o.d"
+  "CMakeFiles/sm.dir/space3delementevaluator.C.o"
+  "CMakeFiles/sm.dir/space3delementevaluator.C.o.d"
+  "CMakeFiles/sm.dir/springelement.C.o"
+  "CMakeFiles/sm.dir/springelement.C.o.d"
+  "CMakeFiles/sm.dir/staticfracture.C.o"
+  "CMakeFiles/sm.dir/staticfracture.C.o.d"
+  "CMakeFiles/sm.dir/steel1.C.o"
+  "CMakeFiles/sm.dir/steel1.C.o.d"
+  "CMakeFiles/sm.dir/structeigenstrainload.C.o"
+  "CMakeFiles/sm.dir/structeigenstrainload.C.o.d"
+  "CMakeFiles/sm.dir/structengngmodel.C.o"
+  "CMakeFiles/sm.dir/structengngmodel.C.o.d"
+  "CMakeFiles/sm.dir/structtemperatureload.C.o"
+  "CMakeFiles/sm.dir/structtemperatureload.C.o.d"
+  "CMakeFiles/sm.dir/structuralcrosssection.C.o"
+  "CMakeFiles/sm.dir/structuralcrosssection.C.o.d"
+  "CMakeFiles/sm.dir/structuralelement.C.o"
+  "CMakeFiles/sm.dir/structuralelement.C.o.d"
+  "CMakeFiles/sm.dir/structuralelementevaluator.C.o"
+  "CMakeFiles/sm.dir/structuralelementevaluator.C.o.d"
+  "CMakeFiles/sm.dir/structuralinterfacematerial.C.o"
+  "CMakeFiles/sm.dir/structuralinterfacematerial.C.o.d"
+  "CMakeFiles/sm.dir/structuralinterfacematerialstatus.C.o"
+  "CMakeFiles/sm.dir/structuralinterfacematerialstatus.C.o.d"
+  "CMakeFiles/sm.dir/structuralmaterial.C.o"
+  "CMakeFiles/sm.dir/structuralmaterial.C.o.d"
+  "CMakeFiles/sm.dir/structuralms.C.o"
+  "CMakeFiles/sm.dir/structuralms.C.o.d"
+  "CMakeFiles/sm.dir/symmetrybarrier.C.o"
+  "CMakeFiles/sm.dir/symmetrybarrier.C.o.d"
+  "CMakeFiles/sm.dir/tf1.C.o"
+  "CMakeFiles/sm.dir/tf1.C.o.d"
+  "CMakeFiles/sm.dir/tr2shell7.C.o"
+  "CMakeFiles/sm.dir/tr2shell7.C.o.d"
+  "CMakeFiles/sm.dir/tr2shell7xfem.C.o"
+  "CMakeFiles/sm.dir/tr2shell7xfem.C.o.d"
+  "CMakeFiles/sm.dir/tr_shell01.C.o"
+  "CMakeFiles/sm.dir/tr_shell01.C.o.d"
+  "CMakeFiles/sm.dir/trabbone3d.C.o"
+  "CMakeFiles/sm.dir/trabbone3d.C.o.d"
+  "CMakeFiles/sm.dir/trabboneembed.C.o"
+  "CMakeFiles/sm.dir/trabboneembed.C.o.d"
+  "CMakeFiles/sm.dir/trabbonegrad3d.C.o"
+  "CMakeFiles/sm.dir/trabbonegrad3d.C.o.d"
+  "CMakeFiles/sm.dir/trabbonematerial.C.o"
+  "CMakeFiles/sm.dir/trabbonematerial.C.o.d"
+  "CMakeFiles/sm.dir/trabbonenl.C.o"
+  "CMakeFiles/sm.dir/trabbonenl.C.o.d"
+  "CMakeFiles/sm.dir/trabbonenl3d.C.o"
+  "CMakeFiles/sm.dir/trabbonenl3d.C.o.d"
+  "CMakeFiles/sm.dir/trabbonenlembed.C.o"
+  "CMakeFiles/sm.dir/trabbonenlembed.C.o.d"
+  "CMakeFiles/sm.dir/trplanestrain.C.o"
+  "CMakeFiles/sm.dir/trplanestrain.C.o.d"
+  "CMakeFiles/sm.dir/trplanestressrotallman.C.o"
+  "CMakeFiles/sm.dir/trplanestressrotallman.C.o.d"
+  "CMakeFiles/sm.dir/trplanrot.C.o"
+  "CMakeFiles/sm.dir/trplanrot.C.o.d"
+  "CMakeFiles/sm.dir/trplanrot3d.C.o"
+  "CMakeFiles/sm.dir/trplanrot3d.C.o.d"
+  "CMakeFiles/sm.dir/trplanstrss.C.o"
+  "CMakeFiles/sm.dir/trplanstrss.C.o.d"
+  "CMakeFiles/sm.dir/trplanstrssxfem.C.o"
+  "CMakeFiles/sm.dir/trplanstrssxfem.C.o.d"
+  "CMakeFiles/sm.dir/truss1d.C.o"
+  "CMakeFiles/sm.dir/truss1d.C.o.d"
+  "CMakeFiles/sm.dir/truss2d.C.o"
+  "CMakeFiles/sm.dir/truss2d.C.o.d"
+  "CMakeFiles/sm.dir/truss3d.C.o"
+  "CMakeFiles/sm.dir/truss3d.C.o.d"
+  "CMakeFiles/sm.dir/usrdeftempfield.C.o"
+  "CMakeFiles/sm.dir/usrdeftempfield.C.o.d"
+  "CMakeFiles/sm.dir/xfemstatic.C.o"
+  "CMakeFiles/sm.dir/xfemstatic.C.o.d"
+  "CMakeFiles/sm.dir/zzerrorestimator.C.o"
+  "CMakeFiles/sm.dir/zzerrorestimator.C.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,48 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/tm/anisomassmat.C" "src/tm/CMakeFiles/tm.dir/anisomassmat.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/anisomassmat.C.o.d"
+  "/root/repo/src/tm/bazantnajjarmat.C" "src/tm/CMakeFiles/tm.dir/bazantnajjarmat.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/bazantnajjarmat.C.o.d"
+  "/root/repo/src/tm/brick1_ht.C" "src/tm/CMakeFiles/tm.dir/brick1_ht.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/brick1_ht.C.o.d"
+  "/root/repo/src/tm/darcyflow.C" "src/tm/CMakeFiles/tm.dir/darcyflow.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/darcyflow.C.o.d"
+  "/root/repo/src/tm/gravitypressure.C" "src/tm/CMakeFiles/tm.dir/gravitypressure.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/gravitypressure.C.o.d"
+  "/root/repo/src/tm/hemotkmat.C" "src/tm/CMakeFiles/tm.dir/hemotkmat.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/hemotkmat.C.o.d"
+  "/root/repo/src/tm/hydratingconcretemat.C" "src/tm/CMakeFiles/tm.dir/hydratingconcretemat.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/hydratingconcretemat.C.o.d"
+  "/root/repo/src/tm/hydratinghemomat.C" "src/tm/CMakeFiles/tm.dir/hydratinghemomat.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/hydratinghemomat.C.o.d"
+  "/root/repo/src/tm/hydratingisoheatmat.C" "src/tm/CMakeFiles/tm.dir/hydratingisoheatmat.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/hydratingisoheatmat.C.o.d"
+  "/root/repo/src/tm/isoheatmat.C" "src/tm/CMakeFiles/tm.dir/isoheatmat.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/isoheatmat.C.o.d"
+  "/root/repo/src/tm/isolinmoisturemat.C" "src/tm/CMakeFiles/tm.dir/isolinmoisturemat.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/isolinmoisturemat.C.o.d"
+  "/root/repo/src/tm/isomoisturemat.C" "src/tm/CMakeFiles/tm.dir/isomoisturemat.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/isomoisturemat.C.o.d"
+  "/root/repo/src/tm/lattice2d_mt.C" "src/tm/CMakeFiles/tm.dir/lattice2d_mt.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/lattice2d_mt.C.o.d"
+  "/root/repo/src/tm/latticetransmat.C" "src/tm/CMakeFiles/tm.dir/latticetransmat.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/latticetransmat.C.o.d"
+  "/root/repo/src/tm/latticetransportelement.C" "src/tm/CMakeFiles/tm.dir/latticetransportelement.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/latticetransportelement.C.o.d"
+  "/root/repo/src/tm/nlisomoisturemat.C" "src/tm/CMakeFiles/tm.dir/nlisomoisturemat.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/nlisomoisturemat.C.o.d"
+  "/root/repo/src/tm/nltransienttransportproblem.C" "src/tm/CMakeFiles/tm.dir/nltransienttransportproblem.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/nltransienttransportproblem.C.o.d"
+  "/root/repo/src/tm/nonlinearmassmat.C" "src/tm/CMakeFiles/tm.dir/nonlinearmassmat.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/nonlinearmassmat.C.o.d"
+  "/root/repo/src/tm/nonstationarytransportproblem.C" "src/tm/CMakeFiles/tm.dir/nonstationarytransportproblem.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/nonstationarytransportproblem.C.o.d"
+  "/root/repo/src/tm/qbrick1_ht.C" "src/tm/CMakeFiles/tm.dir/qbrick1_ht.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/qbrick1_ht.C.o.d"
+  "/root/repo/src/tm/quad1_ht.C" "src/tm/CMakeFiles/tm.dir/quad1_ht.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/quad1_ht.C.o.d"
+  "/root/repo/src/tm/quadaxisym1_ht.C" "src/tm/CMakeFiles/tm.dir/quadaxisym1_ht.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/quadaxisym1_ht.C.o.d"
+  "/root/repo/src/tm/rvestokesflow.C" "src/tm/CMakeFiles/tm.dir/rvestokesflow.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/rvestokesflow.C.o.d"
+  "/root/repo/src/tm/stationarytransportproblem.C" "src/tm/CMakeFiles/tm.dir/stationarytransportproblem.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/stationarytransportproblem.C.o.d"
+  "/root/repo/src/tm/tetrah1_ht.C" "src/tm/CMakeFiles/tm.dir/tetrah1_ht.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/tetrah1_ht.C.o.d"
+  "/root/repo/src/tm/tr1_ht.C" "src/tm/CMakeFiles/tm.dir/tr1_ht.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/tr1_ht.C.o.d"
+  "/root/repo/src/tm/tr1darcy.C" "src/tm/CMakeFiles/tm.dir/tr1darcy.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/tr1darcy.C.o.d"
+  "/root/repo/src/tm/transportelement.C" "src/tm/CMakeFiles/tm.dir/transportelement.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/transportelement.C.o.d"
+  "/root/repo/src/tm/transportmaterial.C" "src/tm/CMakeFiles/tm.dir/transportmaterial.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/transportmaterial.C.o.d"
+  "/root/repo/src/tm/traxisym1_ht.C" "src/tm/CMakeFiles/tm.dir/traxisym1_ht.C.o" "gcc" "src/tm/CMakeFiles/tm.dir/traxisym1_ht.C.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
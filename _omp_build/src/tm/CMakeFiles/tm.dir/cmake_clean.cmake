@@ -0,0 +1,67 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tm.dir/anisomassmat.C.o"
+  "CMakeFiles/tm.dir/anisomassmat.C.o.d"
+  "CMakeFiles/tm.dir/bazantnajjarmat.C.o"
+  "CMakeFiles/tm.dir/bazantnajjarmat.C.o.d"
+  "CMakeFiles/tm.dir/brick1_ht.C.o"
+  "CMakeFiles/tm.dir/brick1_ht.C.o.d"
+  "CMakeFiles/tm.dir/darcyflow.C.o"
+  "CMakeFiles/tm.dir/darcyflow.C.o.d"
+  "CMakeFiles/tm.dir/gravitypressure.C.o"
+  "CMakeFiles/tm.dir/gravitypressure.C.o.d"
+  "CMakeFiles/tm.dir/hemotkmat.C.o"
+  "CMakeFiles/tm.dir/hemotkmat.C.o.d"
+  "CMakeFiles/tm.dir/hydratingconcretemat.C.o"
+  "CMakeFiles/tm.dir/hydratingconcretemat.C.o.d"
+  "CMakeFiles/tm.dir/hydratinghemomat.C.o"
+  "CMakeFiles/tm.dir/hydratinghemomat.C.o.d"
+  "CMakeFiles/tm.dir/hydratingisoheatmat.C.o"
+  "CMakeFiles/tm.dir/hydratingisoheatmat.C.o.d"
+  "CMakeFiles/tm.dir/isoheatmat.C.o"
+  "CMakeFiles/tm.dir/isoheatmat.C.o.d"
+  "CMakeFiles/tm.dir/isolinmoisturemat.C.o"
+  "CMakeFiles/tm.dir/isolinmoisturemat.C.o.d"
+  "CMakeFiles/tm.dir/isomoisturemat.C.o"
+  "CMakeFiles/tm.dir/isomoisturemat.C.o.d"
+  "CMakeFiles/tm.dir/lattice2d_mt.C.o"
+  "CMakeFiles/tm.dir/lattice2d_mt.C.o.d"
+  "CMakeFiles/tm.dir/latticetransmat.C.o"
+  "CMakeFiles/tm.dir/latticetransmat.C.o.d"
+  "CMakeFiles/tm.dir/latticetransportelement.C.o"
+  "CMakeFiles/tm.dir/latticetransportelement.C.o.d"
+  "CMakeFiles/tm.dir/nlisomoisturemat.C.o"
+  "CMakeFiles/tm.dir/nlisomoisturemat.C.o.d"
+  "CMakeFiles/tm.dir/nltransienttransportproblem.C.o"
+  "CMakeFiles/tm.dir/nltransienttransportproblem.C.o.d"
+  "CMakeFiles/tm.dir/nonlinearmassmat.C.o"
+  "CMakeFiles/tm.dir/nonlinearmassmat.C.o.d"
+  "CMakeFiles/tm.dir/nonstationarytransportproblem.C.o"
+  "CMakeFiles/tm.dir/nonstationarytransportproblem.C.o.d"
+  "CMakeFiles/tm.dir/qbrick1_ht.C.o"
+  "CMakeFiles/tm.dir/qbrick1_ht.C.o.d"
+  "CMakeFiles/tm.dir/quad1_ht.C.o"
+  "CMakeFiles/tm.dir/quad1_ht.C.o.d"
+  "CMakeFiles/tm.dir/quadaxisym1_ht.C.o"
+  "CMakeFiles/tm.dir/quadaxisym1_ht.C.o.d"
+  "CMakeFiles/tm.dir/rvestokesflow.C.o"
+  "CMakeFiles/tm.dir/rvestokesflow.C.o.d"
+  "CMakeFiles/tm.dir/stationarytransportproblem.C.o"
+  "CMakeFiles/tm.dir/stationarytransportproblem.C.o.d"
+  "CMakeFiles/tm.dir/tetrah1_ht.C.o"
+  "CMakeFiles/tm.dir/tetrah1_ht.C.o.d"
+  "CMakeFiles/tm.dir/tr1_ht.C.o"
+  "CMakeFiles/tm.dir/tr1_ht.C.o.d"
+  "CMakeFiles/tm.dir/tr1darcy.C.o"
+  "CMakeFiles/tm.dir/tr1darcy.C.o.d"
+  "CMakeFiles/tm.dir/transportelement.C.o"
+  "CMakeFiles/tm.dir/transportelement.C.o.d"
+  "CMakeFiles/tm.dir/transportmaterial.C.o"
+  "CMakeFiles/tm.dir/transportmaterial.C.o.d"
+  "CMakeFiles/tm.dir/traxisym1_ht.C.o"
+  "CMakeFiles/tm.dir/traxisym1_ht.C.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
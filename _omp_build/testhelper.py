@@ -0,0 +1,26 @@
+import subprocess,sys,glob
+if sys.argv[3] == 'p':
+    files = glob.glob(sys.argv[2]+'.[0-9]*')
+    command = ['mpirun','-np',str(len(files)),sys.argv[1],'-p','-f',sys.argv[2],'-l','2','-ksp_type','cg']
+elif sys.argv[3] == 'b':
+    # Converts the input file to binary format and runs the converted file; the results are checked against the text input file
+    files = [sys.argv[2]]
+    print('Executing: ', [sys.argv[1],'-f',sys.argv[2],'-bin',sys.argv[2]+'.bin'])
+    if subprocess.call([sys.argv[1],'-f',sys.argv[2],'-bin',sys.argv[2]+'.bin']):
+        exit(1)
+    command = [sys.argv[1],'-f',sys.argv[2]+'.bin','-l','2']
+else:
+    files = [sys.argv[2]]
+    command = [sys.argv[1],'-f',sys.argv[2],'-l','2']
+command.extend(sys.argv[4:])
+print('Executing: ', command)
+if subprocess.call(command):
+    exit(1)
+else:
+    for f in files:
+        python="/root/.pyenv/shims/python2.7"
+        extractor = "/root/repo/tools/extractor.py"
+        print('Executing: ', [python, extractor, '-f', f, '-c'])
+        if subprocess.call([python, extractor, '-f', f, '-c']):
+            exit(2)
+exit(0)
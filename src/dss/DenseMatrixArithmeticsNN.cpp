@@ -179,6 +179,9 @@ void DenseMatrixArithmetics :: Cholesky_Decomposition(double *pC, double * &p)
                     p [ i ] = sqrt(sum);
                 } else {
                     p [ i ] = 1.0;
+#ifdef _OPENMP
+ #pragma omp atomic
+#endif
                     DenseMatrixArithmetics :: zero_pivots++;
                 }
             } else   {
@@ -281,6 +284,9 @@ void DenseMatrixArithmetics :: LL_Decomposition(double *pC)
                 } else {
                     this->MT.Write("Matrix is not positive definite.");
                     a [ bn * i ] = 1.0;
+#ifdef _OPENMP
+ #pragma omp atomic
+#endif
                     DenseMatrixArithmetics :: zero_pivots++;
                 }
             } else   {
@@ -402,6 +408,9 @@ void DenseMatrixArithmetics :: LU_Decomposition(double *C)
 
         if ( a [ j + n * j ] == 0.0 ) {
             a [ j + n * j ] = TINY;
+#ifdef _OPENMP
+ #pragma omp atomic
+#endif
             DenseMatrixArithmetics :: zero_pivots++;
         } else   {
             a [ j + n * j ] = 1.0 / a [ j + n * j ]; //invert block
@@ -513,6 +522,9 @@ void DenseMatrixArithmetics :: LDL_Decomposition(double *A)
                 }
             }
 
+#ifdef _OPENMP
+ #pragma omp atomic
+#endif
             DenseMatrixArithmetics :: zero_pivots++;
             * Ajj = eMT->stabil_pivot;
         }
@@ -614,6 +626,9 @@ void DenseMatrixArithmetics1x1 :: GetInversion(double *pC, double *pA)
 void DenseMatrixArithmetics1x1 :: FactorizeBlock(double *A)
 {
     if ( * A == 0.0 ) {
+#ifdef _OPENMP
+ #pragma omp atomic
+#endif
         DenseMatrixArithmetics :: zero_pivots++;
         * A = 1.0;
     } else {
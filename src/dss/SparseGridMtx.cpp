@@ -34,6 +34,10 @@
 
 #include "SparseGridMtx.h"
 
+#ifdef _OPENMP
+ #include <omp.h>
+#endif
+
 DSS_NAMESPASE_BEGIN
 
 // Allocates new space according to bskl and reads old matrix with respect
@@ -156,5 +160,147 @@ void SparseGridMtx :: WriteStatistics(long no_init_blocks, long no_nonzeros)
 void SparseGridMtx :: MultiplyByVector(const LargeVectorAttach &x, LargeVectorAttach &y)
 {}
 
+bool SparseGridMtx :: ComputeEliminationTree(long *parent)
+{
+    for ( long bj = 0; bj < n_blocks; bj++ ) {
+        parent [ bj ] = -1;
+    }
+
+    // Columns are visited in increasing order, so the first column referencing a block is its parent
+    for ( long bj = 0; bj < n_blocks; bj++ ) {
+        SparseGridColumn &columnJ = * Columns [ bj ];
+        long *columnJentries = columnJ.IndexesUfa->Items;
+        for ( long idx = 0; idx < columnJ.Entries; idx++ ) {
+            if ( parent [ columnJentries [ idx ] ] < 0 ) {
+                parent [ columnJentries [ idx ] ] = bj;
+            }
+        }
+    }
+
+    // With a filled pattern the parent of every block in column J is again in column J (or is J itself),
+    // hence all blocks column J depends on are its descendants.
+    long *mark = new long [ n_blocks ];
+    for ( long bj = 0; bj < n_blocks; bj++ ) {
+        mark [ bj ] = -1;
+    }
+
+    bool closed = true;
+    for ( long bj = 0; bj < n_blocks && closed; bj++ ) {
+        SparseGridColumn &columnJ = * Columns [ bj ];
+        long *columnJentries = columnJ.IndexesUfa->Items;
+        mark [ bj ] = bj;
+        for ( long idx = 0; idx < columnJ.Entries; idx++ ) {
+            mark [ columnJentries [ idx ] ] = bj;
+        }
+
+        for ( long idx = 0; idx < columnJ.Entries; idx++ ) {
+            if ( mark [ parent [ columnJentries [ idx ] ] ] != bj ) {
+                closed = false;
+                break;
+            }
+        }
+    }
+
+    delete [] mark;
+    return closed;
+}
+
+bool SparseGridMtx :: FactorizeByEliminationTree()
+{
+#ifdef _OPENMP
+    if ( omp_get_max_threads() < 2 || n_blocks < 2 ) {
+        return false;
+    }
+
+    long *parent = new long [ n_blocks ];
+    if ( !ComputeEliminationTree(parent) ) {
+        delete [] parent;
+        return false;
+    }
+
+    // Number of children not yet factorized, a column becomes ready when this drops to zero
+    long *pending = new long [ n_blocks ];
+    memset( pending, 0, n_blocks * sizeof( long ) );
+    for ( long bj = 0; bj < n_blocks; bj++ ) {
+        if ( parent [ bj ] >= 0 ) {
+            pending [ parent [ bj ] ]++;
+        }
+    }
+
+    long *leaves = new long [ n_blocks ];
+    long no_leaves = 0;
+    for ( long bj = 0; bj < n_blocks; bj++ ) {
+        if ( pending [ bj ] == 0 ) {
+            leaves [ no_leaves++ ] = bj;
+        }
+    }
+
+    // Every thread starts at a leaf and climbs towards the root. The thread finishing the last child of
+    // a column continues with that column, the others pick the next leaf. Idle threads thus take over
+    // the remaining subtrees dynamically; the computation of each column is identical to the sequential one.
+    // The block arithmetics keep intermediate results in members, so every thread needs its own. They are
+    // created beforehand because their constructor resets the shared zero pivot counter.
+    int no_threads = omp_get_max_threads();
+    long no_mults = 0;
+    DenseMatrixArithmetics **ariths = new DenseMatrixArithmetics * [ no_threads ];
+    for ( int i = 0; i < no_threads; i++ ) {
+        ariths [ i ] = DenseMatrixArithmetics :: NewArithmetics(block_size);
+        ariths [ i ]->eMT = eMT;
+        ariths [ i ]->prefered_decomposition = BlockArith->prefered_decomposition;
+    }
+
+ #pragma omp parallel num_threads(no_threads) reduction(+:no_mults)
+    {
+        DenseMatrixArithmetics *arith = ariths [ omp_get_thread_num() ];
+        long *p_blockJ_pattern = new long [ n_blocks + 1 ];
+        memset( p_blockJ_pattern, 0, ( n_blocks + 1 ) * sizeof( long ) );
+
+ #pragma omp for schedule(dynamic, 1)
+        for ( long il = 0; il < no_leaves; il++ ) {
+            long bj = leaves [ il ];
+            while ( bj >= 0 ) {
+                no_mults += FactorizeBlockColumn(bj, p_blockJ_pattern, arith);
+
+                long bp = parent [ bj ];
+                if ( bp < 0 ) {
+                    break;
+                }
+
+                long left;
+ #pragma omp flush
+ #pragma omp atomic capture
+                left = --pending [ bp ];
+                if ( left > 0 ) {
+                    break;
+                }
+
+ #pragma omp flush
+                bj = bp;
+            }
+        }
+
+        delete [] p_blockJ_pattern;
+    }
+
+    for ( int i = 0; i < no_threads; i++ ) {
+        delete ariths [ i ];
+    }
+
+    delete [] ariths;
+
+    no_multiplications += no_mults;
+    eMT->act_block = n_blocks * block_size;
+
+    delete [] leaves;
+    delete [] pending;
+    delete [] parent;
+    return true;
+
+#else
+    return false;
+
+#endif
+}
+
 
 DSS_NAMESPASE_END
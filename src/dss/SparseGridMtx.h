@@ -119,6 +119,21 @@ public:
     virtual void MultiplyByVector(const LargeVectorAttach &x, LargeVectorAttach &y);
     virtual void Factorize() = 0;
 
+protected:
+    // Computes the block elimination tree, parent[bj] is the first column whose pattern contains block bj
+    // (-1 for roots). Returns false if the column patterns are not closed under fill, i.e. some column
+    // depends on a block column that is not its descendant in the tree.
+    bool ComputeEliminationTree(long *parent);
+
+    // Factorizes block column bj using the already factorized columns in its pattern and returns the number
+    // of block multiplications. The pattern work array and the block arithmetics have to be private to the
+    // calling thread. Implemented by the formats supporting FactorizeByEliminationTree.
+    virtual long FactorizeBlockColumn(long bj, long *p_blockJ_pattern, DenseMatrixArithmetics *arith) { return 0; }
+
+    // Factorizes all block columns, independent subtrees of the elimination tree are processed
+    // concurrently. Returns false (and does nothing) if the factorization should run sequentially.
+    bool FactorizeByEliminationTree();
+
 public:
 
     virtual void SchurComplementFactorization(int fixed_blocks) = 0;
@@ -328,104 +328,103 @@ void SparseGridMtxLDL :: MultiplyByVector(const LargeVectorAttach &x, LargeVecto
     }
 } //MultiplyByVector
 
-void SparseGridMtxLDL :: Factorize()
+long SparseGridMtxLDL :: FactorizeBlockColumn(long bj, long *p_blockJ_pattern, DenseMatrixArithmetics *arith)
 {
-    double *Atmp = new double [ block_storage ];
-    long bi, bj, min_bi_J = 0;
-
-    // This is a pattern of blocks in J-th column
-    long *p_blockJ_pattern = new long [ n_blocks + 1 ];
-    memset( p_blockJ_pattern, 0, ( n_blocks + 1 ) * sizeof( long ) );
-
-    long newdotcnount = ( long ) ceil( ( double ) n_blocks / 24.0 );
-    //long newdotcnount = n / 24;
-    BlockArith->zero_pivots = 0;
-
-    no_multiplications = 0;
-
+    long no_mults = 0;
     double *cd = this->Columns_data;
-    double *atmp = Atmp;
-    {
-        double *dd = cd;
-        double *idd = cd;
-        long Djj = 0;
-        eMT->act_block = 0;
-        for ( bj = 0; bj < n_blocks; bj++ ) {
-            SparseGridColumn &columnJ = * Columns [ bj ];
-            long noJentries = columnJ.Entries;
-            if ( noJentries > 0 ) {
-                long *columnJentries = columnJ.IndexesUfa->Items;
-                double *pAkj = cd + columnJ.column_start_idx;
-                double *pAij = pAkj;
+    SparseGridColumn &columnJ = * Columns [ bj ];
+    long noJentries = columnJ.Entries;
+    if ( noJentries > 0 ) {
+        long *columnJentries = columnJ.IndexesUfa->Items;
+        double *pAkj = cd + columnJ.column_start_idx;
+        double *pAij = pAkj;
+
+        for ( long i = noJentries - 1; i >= 0; i-- ) {
+            p_blockJ_pattern [ columnJentries [ i ] ] = ~( i * block_storage );
+        }
 
-                //columnJ.DrawColumnPattern(p_blockJ_pattern,ref min_bi_J,bj);
-                min_bi_J = bj;
-                for ( long i = noJentries - 1; i >= 0; i-- ) {
-                    p_blockJ_pattern [ min_bi_J = columnJentries [ i ] ] = ~( i * block_storage );
+        // eliminate above diagonal
+        for ( long idx_J = 1; idx_J < noJentries; idx_J++ ) {
+            pAij += block_storage;
+            long bi = columnJentries [ idx_J ];
+
+            SparseGridColumn &columnI = * Columns [ bi ];
+            long noIentries = columnI.Entries;
+
+            if ( noIentries > 0 ) {
+                double *pAki = cd + columnI.column_start_idx + ( noIentries - 1 ) * block_storage;
+                long *columnIentries = columnI.IndexesUfa->Items;
+                for ( long *columnIentry = columnIentries + noIentries - 1; columnIentry >= columnIentries; pAki -= block_storage ) {
+                    long idx_K = p_blockJ_pattern [ * columnIentry-- ];
+                    if ( idx_K == 0 ) {
+                        continue;
+                    }
+
+                    arith->SubATBproduct(pAij, pAki, pAkj + ~idx_K);
+                    no_mults++;
                 }
+            }
+        }
 
-                // eliminate above diagonal
-                for ( long idx_J = 1; idx_J < noJentries; idx_J++ ) {
-                    pAij += block_storage;
-                    bi = columnJentries [ idx_J ];
+        // compute the diagonal and divide by it
+        double *Atmp = new double [ block_storage ];
+        for ( long idx = noJentries - 1; idx >= 0; idx-- ) {
+            long bi = columnJentries [ idx ];
+            //Clear pattern
+            p_blockJ_pattern [ bi ] = 0;
 
-                    SparseGridColumn &columnI = * Columns [ bi ];
-                    long noIentries = columnI.Entries;
+            long Aij = columnJ.column_start_idx + idx * block_storage;
+            Array :: Copy(this->Columns_data, Aij, Atmp, 0, block_storage);
 
-                    if ( noIentries > 0 ) {
-                        double *pAki = cd + columnI.column_start_idx + ( noIentries - 1 ) * block_storage;
-                        long *columnIentries = columnI.IndexesUfa->Items;
-                        for ( long *columnIentry = columnIentries + noIentries - 1; columnIentry >= columnIentries; pAki -= block_storage ) {
-                            long idx_K = p_blockJ_pattern [ * columnIentry-- ];
-                            if ( idx_K == 0 ) {
-                                continue;
-                            }
+            //L12 = D1(-1) * A12
+            arith->SubstSolveBlock(cd + bi * block_storage, cd + Aij);
 
-                            BlockArith->SubATBproduct(pAij, pAki, pAkj + ~idx_K);
-                            //no_multiplications++;
-                        }
-                    }
-                }
+            // Atmp = D1 * L12
+            // D2 = A22 - L12(T) * D1 * L12
+            // D2 = A22 - L12(T) * Atmp
+            arith->SubATBproduct(cd + bj * block_storage, Atmp, cd + Aij);
+        }
 
-                // compute the diagonal and divide by it
-                //DenseMatrix Djj = DiagonalBlocks[bj];// Diagonal
-                for ( long idx = noJentries - 1; idx >= 0; idx-- ) {
-                    bi = columnJentries [ idx ];
-                    //Clear pattern
-                    p_blockJ_pattern [ bi ] = 0;
+        delete [] Atmp;
+        no_mults += noJentries;
+    }
 
-                    //DenseMatrix Aij = columnJ.Blocksfa[idx];
-                    long Aij = columnJ.column_start_idx + idx * block_storage;
+    // Factorize diagonal block
+    arith->FactorizeBlock(cd + bj * block_storage);
+    return no_mults;
+}
 
-                    //Aij.CopyTo(ref Atmp,block_size);
-                    Array :: Copy(this->Columns_data, Aij, Atmp, 0, block_storage);
+void SparseGridMtxLDL :: Factorize()
+{
+    BlockArith->zero_pivots = 0;
+    no_multiplications = 0;
+    if ( FactorizeByEliminationTree() ) {
+        ComputeBlocks();
+        return;
+    }
 
-                    //L12 = D1(-1) * A12
-                    BlockArith->SubstSolveBlock(idd + bi * block_storage, cd + Aij);
+    // This is a pattern of blocks in J-th column
+    long *p_blockJ_pattern = new long [ n_blocks + 1 ];
+    memset( p_blockJ_pattern, 0, ( n_blocks + 1 ) * sizeof( long ) );
 
-                    // Atmp = D1 * L12
-                    // D2 = A22 - L12(T) * D1 * L12
-                    // D2 = A22 - L12(T) * Atmp
-                    BlockArith->SubATBproduct(dd + Djj, atmp, cd + Aij);
-                }
-            }
+    long newdotcnount = ( long ) ceil( ( double ) n_blocks / 24.0 );
+    //long newdotcnount = n / 24;
 
-            // Factorize diagonal block
-            BlockArith->FactorizeBlock(dd + Djj);
+    eMT->act_block = 0;
+    for ( long bj = 0; bj < n_blocks; bj++ ) {
+        no_multiplications += FactorizeBlockColumn(bj, p_blockJ_pattern, BlockArith);
 
-            if ( ( bj % newdotcnount ) == 0 ) {
-                Write(".");
-            }
+        if ( ( bj % newdotcnount ) == 0 ) {
+            Write(".");
+        }
 
-            Djj += block_storage;
-            eMT->act_block += block_size;
-            if ( eMT->break_flag ) {
-                break;
-            }
+        eMT->act_block += block_size;
+        if ( eMT->break_flag ) {
+            break;
         }
     }
+
     delete [] p_blockJ_pattern;
-    delete [] Atmp;
     ComputeBlocks();
 }
 
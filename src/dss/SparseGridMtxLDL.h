@@ -115,6 +115,11 @@ public:
     virtual void Factorize();
     virtual void Factorize_Incomplete();
 
+protected:
+    virtual long FactorizeBlockColumn(long bj, long *p_blockJ_pattern, DenseMatrixArithmetics *arith);
+
+public:
+
     LargeVector *tmp_vector_BS_nodes;
     void SolveLDL_node_perm(const LargeVector &b, LargeVector &x);
 
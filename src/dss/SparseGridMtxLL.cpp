@@ -293,92 +293,94 @@ void SparseGridMtxLL :: MultiplyByVector(const LargeVectorAttach &x, LargeVector
     // x;y;
 } //MultiplyByVector
 
-void SparseGridMtxLL :: Factorize()
+long SparseGridMtxLL :: FactorizeBlockColumn(long bj, long *p_blockJ_pattern, DenseMatrixArithmetics *arith)
 {
-    //double* Atmp = new double[block_storage];
-    long bi, bj, min_bi_J = 0;
+    long no_mults = 0;
+    double *cd = this->Columns_data;
+    SparseGridColumn &columnJ = * Columns [ bj ];
+    long noJentries = columnJ.Entries;
+    if ( noJentries > 0 ) {
+        long *columnJentries = columnJ.IndexesUfa->Items;
+        double *pAkj = cd + columnJ.column_start_idx;
+        double *pAij = pAkj;
+
+        for ( long i = noJentries - 1; i >= 0; i-- ) {
+            p_blockJ_pattern [ columnJentries [ i ] ] = ~( i * block_storage );
+        }
 
-    // This is a pattern of blocks in J-th column
-    long *p_blockJ_pattern = new long [ n_blocks + 1 ];
-    memset( p_blockJ_pattern, 0, ( n_blocks + 1 ) * sizeof( long ) );
+        // eliminate above diagonal
+        for ( long idx_J = 0; idx_J < noJentries; idx_J++ ) {
+            long bi = columnJentries [ idx_J ];
 
-    long newdotcnount = ( long ) ceil( ( double ) n_blocks / 24.0 );
-    //long newdotcnount = n / 24;
-    BlockArith->zero_pivots = 0;
+            SparseGridColumn &columnI = * Columns [ bi ];
+            long noIentries = columnI.Entries;
 
-    double *cd = this->Columns_data;
-    //double* atmp = Atmp;
-    {
-        double *dd = cd;
-        //double* idd = cd;
-        long Djj = 0;
-        eMT->act_block = 0;
-        for ( bj = 0; bj < n_blocks; bj++ ) {
-            SparseGridColumn &columnJ = * Columns [ bj ];
-            long noJentries = columnJ.Entries;
-            if ( noJentries > 0 ) {
-                long *columnJentries = columnJ.IndexesUfa->Items;
-                double *pAkj = cd + columnJ.column_start_idx;
-                double *pAij = pAkj;
+            if ( noIentries > 0 ) {
+                double *pAki = cd + columnI.column_start_idx + ( noIentries - 1 ) * block_storage;
+                long *columnIentries = columnI.IndexesUfa->Items;
+                for ( long *columnIentry = columnIentries + noIentries - 1; columnIentry >= columnIentries; pAki -= block_storage ) {
+                    long idx_K = p_blockJ_pattern [ * columnIentry-- ];
+                    if ( idx_K == 0 ) {
+                        continue;
+                    }
 
-                //columnJ.DrawColumnPattern(p_blockJ_pattern,ref min_bi_J,bj);
-                min_bi_J = bj;
-                for ( long i = noJentries - 1; i >= 0; i-- ) {
-                    p_blockJ_pattern [ min_bi_J = columnJentries [ i ] ] = ~( i * block_storage );
+                    arith->SubATBproduct(pAij, pAki, pAkj + ~idx_K);
+                    no_mults++;
                 }
+            }
 
-                // eliminate above diagonal
-                for ( long idx_J = 0; idx_J < noJentries; idx_J++ ) {
-                    bi = columnJentries [ idx_J ];
+            arith->L_BlockSolve(cd + bi * block_storage, pAij);
+            pAij += block_storage;
+        }
 
-                    SparseGridColumn &columnI = * Columns [ bi ];
-                    long noIentries = columnI.Entries;
+        // compute the diagonal
+        for ( long idx = noJentries - 1; idx >= 0; idx-- ) {
+            //Clear pattern
+            p_blockJ_pattern [ columnJentries [ idx ] ] = 0;
 
-                    if ( noIentries > 0 ) {
-                        double *pAki = cd + columnI.column_start_idx + ( noIentries - 1 ) * block_storage;
-                        long *columnIentries = columnI.IndexesUfa->Items;
-                        for ( long *columnIentry = columnIentries + noIentries - 1; columnIentry >= columnIentries; pAki -= block_storage ) {
-                            long idx_K = p_blockJ_pattern [ * columnIentry-- ];
-                            if ( idx_K == 0 ) {
-                                continue;
-                            }
+            long ij = columnJ.column_start_idx + idx * block_storage;
+            arith->SubATBproduct(cd + bj * block_storage, cd + ij, cd + ij);
+        }
 
-                            BlockArith->SubATBproduct(pAij, pAki, pAkj + ~idx_K);
-                        }
-                    }
+        no_mults += noJentries;
+    }
 
-                    BlockArith->L_BlockSolve(dd + bi * block_storage, pAij);
-                    pAij += block_storage;
-                }
+    // Factorize diagonal block
+    arith->LL_Decomposition(cd + bj * block_storage);
+    return no_mults;
+}
 
-                // compute the diagonal and divide by it
-                //DenseMatrix Djj = DiagonalBlocks[bj];// Diagonal
-                for ( long idx = noJentries - 1; idx >= 0; idx-- ) {
-                    bi = columnJentries [ idx ];
-                    //Clear pattern
-                    p_blockJ_pattern [ bi ] = 0;
+void SparseGridMtxLL :: Factorize()
+{
+    BlockArith->zero_pivots = 0;
+    no_multiplications = 0;
+    if ( FactorizeByEliminationTree() ) {
+        ComputeBlocks();
+        return;
+    }
 
-                    int ij = columnJ.column_start_idx + idx * block_storage;
-                    BlockArith->SubATBproduct(dd + Djj, cd + ij, cd + ij);
-                }
-            }
+    // This is a pattern of blocks in J-th column
+    long *p_blockJ_pattern = new long [ n_blocks + 1 ];
+    memset( p_blockJ_pattern, 0, ( n_blocks + 1 ) * sizeof( long ) );
 
-            // Factorize diagonal block
-            BlockArith->LL_Decomposition(dd + Djj);
+    long newdotcnount = ( long ) ceil( ( double ) n_blocks / 24.0 );
+    //long newdotcnount = n / 24;
 
-            if ( ( bj % newdotcnount ) == 0 ) {
-                Write(".");
-            }
+    eMT->act_block = 0;
+    for ( long bj = 0; bj < n_blocks; bj++ ) {
+        no_multiplications += FactorizeBlockColumn(bj, p_blockJ_pattern, BlockArith);
 
-            Djj += block_storage;
-            eMT->act_block += block_size;
-            if ( eMT->break_flag ) {
-                break;
-            }
+        if ( ( bj % newdotcnount ) == 0 ) {
+            Write(".");
+        }
+
+        eMT->act_block += block_size;
+        if ( eMT->break_flag ) {
+            break;
         }
     }
+
     delete [] p_blockJ_pattern;
-    //delete [] Atmp;
     ComputeBlocks();
 }
 
@@ -63,6 +63,8 @@ protected:
     bool isFactorized;
     /// type of storage & factorization
     dssType _type;
+    /// Block to equation mapping the current ordering was built for (empty if the assumed block structure is used).
+    IntArray _mcnPattern;
 
     /// implements 0-based access
     double operator()(int i, int j) const;
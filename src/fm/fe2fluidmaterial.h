@@ -75,10 +75,9 @@ public:
      * Creates new material status.
      * @param n Material status number.
      * @param d Domain that status belongs to.
-     * @param gp Gauss point that the status belongs to.
-     * @param inputfile The input file describing the micro problem.
+     * @param gp Gauss point that the status belongs to, its material has to be a FE2FluidMaterial.
      */
-    FE2FluidMaterialStatus(int n, Domain *d, GaussPoint *gp, const std::string &inputfile);
+    FE2FluidMaterialStatus(int n, Domain *d, GaussPoint *gp);
     /// Destructor
     virtual ~FE2FluidMaterialStatus();
 
@@ -90,8 +89,8 @@ public:
 
     double giveVOFFraction() { return this->voffraction; }
 
-    /// Creates/Initiates the RVE problem.
-    virtual bool createRVE(int n, GaussPoint *gp, const std::string &inputfile);
+    /// Creates/Initiates the RVE problem (see FE2FluidMaterial::instanciateRVE).
+    virtual bool createRVE(int n, GaussPoint *gp);
 
     /// Copies time step data to RVE.
     virtual void setTimeStep(TimeStep *tStep);
@@ -122,23 +121,40 @@ public:
  * - It must have a MixedGradientPressureBC. It should be the only Dirichlet boundary condition.
  * - It must have boundary elements along the outer boundary such that the total volume (including internal pores) can be computed.
  *
+ * The input file of the subscale problem is parsed only once, every integration point instanciates its RVE from the parsed data.
+ * The RVEs also copy the sparse matrix structure of the first RVE, instead of building it from their elements.
+ * The subscale problems are solved one after another; they share the solver and export infrastructure, which is not thread safe.
+ *
  * @author Mikael Öhman
  */
 class FE2FluidMaterial : public FluidDynamicMaterial
 {
 private:
     std::string inputfile;
+    /// Input file of the RVE in binary format, kept in memory (see OOFEMBINDataReader::compile).
+    std::string rveImage;
+    /// Copy of the stiffness matrix of the first RVE, the RVEs of the other integration points copy its structure.
+    SparseMtrx *rveStiffnessTemplate;
     static int n;
 
+    /// Instanciates the RVE problem from the parsed input file.
+    StokesFlow *instanciateRVEProblem();
+
 public:
     /**
      * Constructor. Creates material with given number, belonging to given domain.
      * @param n Material number.
      * @param d Domain to which new material will belong.
      */
-    FE2FluidMaterial(int n, Domain *d) : FluidDynamicMaterial(n, d) { }
+    FE2FluidMaterial(int n, Domain *d) : FluidDynamicMaterial(n, d), rveStiffnessTemplate(NULL) { }
     /// Destructor.
-    virtual ~FE2FluidMaterial() { }
+    virtual ~FE2FluidMaterial();
+
+    /**
+     * Creates a new initialized RVE problem for an integration point.
+     * @return New RVE, NULL if the input file doesn't describe a StokesFlow problem.
+     */
+    StokesFlow *instanciateRVE();
 
     virtual IRResultType initializeFrom(InputRecord *ir);
     virtual void giveInputRecord(DynamicInputRecord &input);
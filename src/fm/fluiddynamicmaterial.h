@@ -41,6 +41,8 @@
 #include "floatarray.h"
 #include "floatmatrix.h"
 
+#include <vector>
+
 
 namespace oofem {
 
@@ -128,6 +130,20 @@ public:
      * @param tStep Time step.
      */
     virtual void computeDeviatoricStressVector(FloatArray &stress_dev, double &epsp_vol, GaussPoint *gp, const FloatArray &eps, double pressure, TimeStep *tStep);
+    /**
+     * Computes the deviatoric stress vectors and volumetric strain rates of several integration points at once.
+     * All points have to belong to the receiver and share the same material mode.
+     * The default implementation evaluates the points one by one,
+     * models that solve a subscale problem per point can override it to share work between the points.
+     * @param stress_dev Deviatoric stresses, one column per integration point.
+     * @param epsp_vol Volumetric strain-rates, one per integration point.
+     * @param gps Integration points.
+     * @param eps Strain-rates, one column per integration point.
+     * @param pressure Pressures, one per integration point.
+     * @param tStep Time step.
+     */
+    virtual void computeDeviatoricStressVectorBatch(FloatMatrix &stress_dev, FloatArray &epsp_vol, const std::vector< GaussPoint * > &gps,
+                                                    const FloatMatrix &eps, const FloatArray &pressure, TimeStep *tStep);
     /**
      * Computes the deviatoric stress vector from given strain.
      * @param answer Deviatoric stress.
@@ -112,6 +112,25 @@ public:
 
     virtual int forceEquationNumbering(int id);
 
+    /**
+     * Creates the stiffness matrix and builds its internal structure, unless it exists already.
+     * @return Stiffness matrix of the receiver.
+     */
+    SparseMtrx *buildStiffnessMatrix();
+    /**
+     * Returns true if the stiffness matrix structure can be copied from (or to) other problems instanciated
+     * from the same input, i.e. for native sparse matrices and meshes which are not generated from topology.
+     */
+    bool canCopyStiffnessMatrixStructure();
+    /**
+     * Initializes the stiffness matrix with a copy of given matrix, instead of building its internal structure
+     * from the elements. The matrix has to come from a problem instanciated from the same input,
+     * so that the equation numberings are the same (see canCopyStiffnessMatrixStructure).
+     * @param source Matrix to copy the structure from.
+     * @return True if the structure was copied.
+     */
+    bool copyStiffnessMatrixStructure(SparseMtrx *source);
+
     /**
      * Initialization from given input record.
      * Reads
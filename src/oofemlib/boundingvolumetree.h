@@ -0,0 +1,126 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+
+#ifndef boundingvolumetree_h
+#define boundingvolumetree_h
+
+#include <vector>
+
+namespace oofem {
+/// Desired max number of items in a leaf of bounding volume tree.
+#define BVTREE_LEAF_SIZE 8
+
+/**
+ * Bounding volume hierarchy of items given by their axis aligned boxes (points are boxes with zero size).
+ * The tree is stored in flat arrays and contains no pointers. The items are reordered so that every tree node
+ * covers a contiguous range of them. The nodes form a complete binary tree in implicit layout,
+ * the children of node i are nodes 2i+1 and 2i+2; each inner node splits its range at the median
+ * along the longest side of its box.
+ * The tree is built level by level and the nodes of one level are processed in parallel.
+ * Once built, the tree is only read by the queries, so these can be evaluated concurrently.
+ * All queries identify the items by their index in the arrays passed to build.
+ */
+class BoundingVolumeTree
+{
+protected:
+    /// Number of items.
+    int nItems;
+    /// Number of tree levels, the last one contains the leaves.
+    int nLevels;
+    /// Item indices in tree order.
+    std :: vector< int >items;
+    /// Item boxes in tree order, three coordinates per item.
+    std :: vector< double >itemLow, itemHigh;
+    /// Item tags in tree order (empty if no tags were given).
+    std :: vector< int >itemTags;
+    /// Node boxes, three coordinates per node.
+    std :: vector< double >nodeLow, nodeHigh;
+    /// Range of items covered by each node.
+    std :: vector< int >nodeBegin, nodeEnd;
+
+public:
+    /// Constructor. Creates empty tree.
+    BoundingVolumeTree() : nItems(0), nLevels(0) { }
+
+    /**
+     * Builds the tree.
+     * @param low Lower corners of item boxes, three coordinates per item.
+     * @param high Upper corners of item boxes, three coordinates per item.
+     * @param tags Tags of items used to filter the closest item query, may be empty.
+     */
+    void build(const std :: vector< double > &low, const std :: vector< double > &high, const std :: vector< int > &tags);
+    /// Removes all items, the tree has to be built again before it is used.
+    void clear();
+    /// Returns true if the tree has been built.
+    bool isBuilt() const { return nLevels > 0; }
+    /// Returns the number of items.
+    int giveNumberOfItems() const { return nItems; }
+
+    /**
+     * Appends the items whose box has distance from given point not greater than given radius.
+     * The items are appended in tree order.
+     * @param answer Item indices.
+     * @param coords Point coordinates (three values).
+     * @param radius Radius of sphere.
+     */
+    void giveItemsWithinSphere(std :: vector< int > &answer, const double *coords, double radius) const;
+    /**
+     * Appends the items whose box, enlarged by given tolerance in each direction, contains given point.
+     * The items are appended in tree order.
+     * @param answer Item indices.
+     * @param coords Point coordinates (three values).
+     * @param tol Tolerance.
+     */
+    void giveItemsContainingPoint(std :: vector< int > &answer, const double *coords, double tol) const;
+    /**
+     * Returns the item whose box is closest to given point.
+     * Only items with positive tag are considered, if tag is positive, only items with this tag are considered.
+     * Of equally distant items, the one with lowest index is returned.
+     * @param coords Point coordinates (three values).
+     * @param tag Required item tag.
+     * @return Item index, -1 if there is no such item.
+     */
+    int giveClosestItem(const double *coords, int tag) const;
+
+protected:
+    /// Returns square of distance between point and box.
+    static double giveDistanceSquare(const double *coords, const double *low, const double *high);
+    /// Returns true if box enlarged by given tolerance in each direction contains point.
+    static bool giveBoxContainsPoint(const double *coords, const double *low, const double *high, double tol);
+    /// Returns true if node is a leaf.
+    bool isLeaf(int node) const { return 2 * node + 1 >= ( int ) nodeBegin.size(); }
+};
+} // end namespace oofem
+#endif // boundingvolumetree_h
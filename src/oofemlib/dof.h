@@ -52,7 +52,6 @@ class CommunicationBuffer;
 #endif
 
 class DataStream;
-class Dictionary;
 class PrimaryField;
 class Domain;
 class DofManager;
@@ -396,6 +395,13 @@ public:
      * @param dofValue Value of the dof.
      */
     virtual void giveUnknownsDictionaryValue(TimeStep *tStep, ValueModeType mode, double &dofValue) { }
+    /**
+     * Tests whether the dictionary contains value of given mode.
+     * @param tStep Time step.
+     * @param mode Mode of value.
+     * @return True if the value has been stored by updateUnknownsDictionary.
+     */
+    virtual bool hasUnknownsDictionaryValue(TimeStep *tStep, ValueModeType mode) { return false; }
 
     /// Prints simple error message and exits.
     void error(const char *file, int line, const char *format, ...) const;
@@ -414,17 +420,6 @@ public:
      */
     virtual void setEquationNumber(int equationNumber) {};
 
-    /**
-     * Sets the dictionary of unknowns for receiver.
-     * @param unknowns New dictionary of unknowns.
-     */
-    virtual void setUnknowns(Dictionary *unknowns) {};
-    /**
-     * Receives the dictionary of unknowns in receiver.
-     * @return Dictionary of unknowns for DOF.
-     */
-    virtual Dictionary *giveUnknowns() { return NULL; }
-
     /**
      * Gives number for equation, negative for prescribed equations.
      * @return Equation number of receiver.
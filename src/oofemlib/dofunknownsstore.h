@@ -0,0 +1,115 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef dofunknownsstore_h
+#define dofunknownsstore_h
+
+#include "contextioresulttype.h"
+
+#include <vector>
+
+namespace oofem {
+class DataStream;
+
+/**
+ * Storage of DOF unknowns dictionaries of the engineering model.
+ *
+ * Models supporting changes of static system keep the history of the unknowns on the DOF level
+ * (see EngngModel::requiresUnknownsDictionaryUpdate), since the equation numbers change between steps.
+ * Instead of a dictionary allocated by each DOF, the values are stored here in one contiguous array
+ * per dictionary hash index (see EngngModel::giveUnknownDictHashIndx).
+ * Each master DOF having some values owns a slot, which indexes these arrays and which is kept when
+ * the equations are renumbered. Moving the history between hash indices is then a copy of a single array.
+ *
+ * Slots are numbered from 1, zero means no slot. Slots released by deleted DOFs are reused.
+ */
+class DofUnknownsStore
+{
+protected:
+    /// Hash indices of stored arrays.
+    std::vector< int > hashes;
+    /// Values of unknowns, for each hash index indexed by slot.
+    std::vector< std::vector< double > > values;
+    /// Flags marking the slots having a value, for each hash index.
+    std::vector< std::vector< bool > > defined;
+    /// Number of allocated slots.
+    int nslots;
+    /// Released slots to be reused.
+    std::vector< int > freeSlots;
+
+public:
+    /// Constructor. Creates empty store.
+    DofUnknownsStore();
+    /// Destructor.
+    ~DofUnknownsStore() { }
+
+    /// Allocates new slot, all its values are undefined.
+    int giveNewSlot();
+    /// Releases the slot, its values become undefined.
+    void releaseSlot(int slot);
+
+    /// Returns true if value of given hash index is defined for the slot.
+    bool includes(int slot, int hash) const;
+    /// Returns value of given hash index for the slot, zero if not defined.
+    double at(int slot, int hash) const;
+    /// Sets value of given hash index for the slot.
+    void update(int slot, int hash, double value);
+    /**
+     * Copies values of all slots from one hash index to another.
+     * Slots without value at source index become undefined at target index.
+     */
+    void copy(int fromHash, int toHash);
+
+    /**
+     * Stores the values of the slot, in the format of Dictionary::saveContext.
+     * @param stream Output stream.
+     * @param slot Slot number, zero for none.
+     */
+    contextIOResultType saveSlotContext(DataStream *stream, int slot) const;
+    /**
+     * Restores the values of the slot, stored by saveSlotContext or Dictionary::saveContext.
+     * Previous values of the slot are cleared, new slot is allocated if necessary.
+     * @param stream Input stream.
+     * @param slot Slot number, zero for none (updated on output).
+     */
+    contextIOResultType restoreSlotContext(DataStream *stream, int &slot);
+
+protected:
+    /// Returns position of the array of given hash index, or -1 if not present and not created.
+    int giveHashPosition(int hash, bool create);
+    /// Returns position of the array of given hash index, or -1 if not present.
+    int giveHashPosition(int hash) const;
+};
+} // end namespace oofem
+#endif // dofunknownsstore_h
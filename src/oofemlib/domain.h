@@ -88,6 +88,7 @@ class ConnectivityTable;
 class ErrorEstimator;
 class SpatialLocalizer;
 class NodalRecoveryModel;
+class NodalRecoveryCache;
 class NonlocalBarrier;
 class DomainTransactionManager;
 class RandomFieldGenerator;
@@ -176,6 +177,8 @@ private:
     int nsd;
     /// nodal recovery object associated to receiver.
     NodalRecoveryModel *smoother;
+    /// Values recovered by the nodal recovery models of the receiver.
+    NodalRecoveryCache *nodalRecoveryCache;
 
     std::string mDomainType;
     /**
@@ -571,6 +574,11 @@ public:
      * @param destroyOld Determines if any preexisting smoother should be deleted.
      */
     void setSmoother(NodalRecoveryModel *smoother, bool destroyOld = true);
+    /**
+     * Returns the cache of nodal values recovered by the recovery models of the receiver.
+     * Creates the cache, if it does not exist yet.
+     */
+    NodalRecoveryCache *giveNodalRecoveryCache();
 
 #ifdef __PARALLEL_MODE
     /**@name Domain transaction support methods.
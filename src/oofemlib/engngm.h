@@ -70,6 +70,7 @@
 #endif
 
 #include <string>
+#include <vector>
 
 ///@name Input fields for general Engineering models.
 //@{
@@ -83,6 +84,7 @@
 #define _IFT_EngngModel_parallelflag "parallelflag"
 #define _IFT_EngngModel_loadBalancingFlag "lbflag"
 #define _IFT_EngngModel_forceloadBalancingFlag "forcelb1"
+#define _IFT_EngngModel_frozenPattern "frozenpattern"
 #define _IFT_EngngModel_initialGuess "initialguess"
 
 #define _IFT_EngngModel_lstype "lstype"
@@ -106,6 +108,7 @@ class SparseMtrx;
 class NumericalMethod;
 class InitModuleManager;
 class ExportModuleManager;
+class DofUnknownsStore;
 class FloatMatrix;
 class FloatArray;
 
@@ -223,6 +226,12 @@ protected:
     bool profileOpt;
     /// Equation numbering completed flag.
     int equationNumberingCompleted;
+    /**
+     * Frozen pattern flag. If set, scatter maps of element contributions are cached on the sparse matrices
+     * (where supported) and reused until the matrix structure is rebuilt.
+     * Assumes each matrix is assembled with fixed equation id and numbering scheme.
+     */
+    bool frozenPatternFlag;
     /// Number of meta steps.
     int nMetaSteps;
     /// List of problem metasteps.
@@ -255,6 +264,8 @@ protected:
     ExportModuleManager *exportModuleManager;
     /// Initialization module manager.
     InitModuleManager *initModuleManager;
+    /// Storage of DOF unknowns dictionaries, created on demand.
+    DofUnknownsStore *dofUnknownsStore;
 
     /// Domain mode.
     problemMode pMode;
@@ -340,6 +351,12 @@ protected:
     AList< PetscContext > *petscContextList;
 #endif
 
+    /**
+     * Element coloring for each domain (computed on demand, see giveElementColoring).
+     * Each color holds the numbers of elements which do not share any degree of freedom.
+     */
+    std::vector< std::vector< IntArray > > elementColoring;
+
 public:
     /**
      * Constructor. Creates Engng model with number i.
@@ -837,6 +854,11 @@ public:
      * actual one to avoid storage of complete history.
      */
     virtual int giveUnknownDictHashIndx(ValueModeType mode, TimeStep *stepN) { return 0; }
+    /**
+     * Returns the storage of DOF unknowns dictionaries, where master DOFs keep their values.
+     * @see DofUnknownsStore
+     */
+    DofUnknownsStore *giveDofUnknownsStore();
     /**
      * Returns UnknownNUmberingScheme related to given EquationID
      */
@@ -980,7 +1002,48 @@ public:
     void assembleExtrapolatedForces(FloatArray &answer, TimeStep *tStep, EquationID eid,
                                     CharType type, Domain *domain);
 
+    /**
+     * Returns the element coloring of given domain.
+     * Elements of the same color share no degree of freedom (slave dofs are resolved to their masters),
+     * so their contributions can be assembled into a global matrix concurrently, without locking.
+     * The coloring is independent of the numbering scheme and equation id. It is computed on first request
+     * and kept until the equation numbering of the domain is redone.
+     * @param di Domain number.
+     * @return List of colors, each containing the numbers of the elements of that color.
+     */
+    const std::vector< IntArray > &giveElementColoring(int di);
+
 protected:
+    /**
+     * Computes the characteristic matrix of given element and assembles it into given sparse matrix.
+     * This is the body of the element loop in assemble.
+     * @param answer Assembled matrix.
+     * @param ielem Element number.
+     * @param tStep Time step, when answer is assembled.
+     * @param eid Determines type of equation and corresponding element code numbers.
+     * @param type Characteristic components of type type are requested from elements and assembled.
+     * @param r_s Determines the equation numbering scheme for the rows.
+     * @param c_s Determines the equation numbering scheme for the columns. If NULL, a square contribution is assembled using r_s.
+     * @param domain Source domain.
+     * @param serialize If true, the update of answer is done in a critical section (needed when elements sharing dofs are processed concurrently).
+     */
+    void assembleElementMatrix(SparseMtrx *answer, int ielem, TimeStep *tStep, EquationID eid, CharType type,
+                               const UnknownNumberingScheme &r_s, const UnknownNumberingScheme *c_s, Domain *domain, bool serialize);
+    /**
+     * Assembles given element matrix into sparse matrix, taking element rotation into account.
+     * Uses the cached scatter map of the element in frozen pattern mode.
+     * @param answer Assembled matrix.
+     * @param ielem Element number.
+     * @param mat Element matrix in element local coordinate system, rotated in place.
+     * @param eid Determines type of equation and corresponding element code numbers.
+     * @param r_s Determines the equation numbering scheme for the rows.
+     * @param c_s Determines the equation numbering scheme for the columns. If NULL, a square contribution is assembled using r_s.
+     * @param domain Source domain.
+     * @param serialize If true, the update of answer is done in a critical section.
+     */
+    void scatterElementMatrix(SparseMtrx *answer, int ielem, FloatMatrix &mat, EquationID eid,
+                              const UnknownNumberingScheme &r_s, const UnknownNumberingScheme *c_s, Domain *domain, bool serialize);
+
 #ifdef __PARALLEL_MODE
     /**
      * Packs receiver data when rebalancing load. When rebalancing happens, the local numbering will be lost on majority of processors.
@@ -1047,6 +1110,11 @@ public:
     virtual int isIncremental() { return 0; }
     /// Returns nonzero if nonlocal stiffness option activated.
     virtual int useNonlocalStiffnessOption() { return 0; }
+    /**
+     * Returns true if receiver can update the internal forces together with the nonlinear lhs
+     * in one call (see InternalRhs_NonLinearLhs component of updateComponent).
+     */
+    virtual bool supportsInternalRhs_NonLinearLhs() { return false; }
     /// Returns true if receiver in parallel mode
     bool isParallel() { return ( parallelFlag != 0 ); }
 
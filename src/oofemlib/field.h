@@ -41,6 +41,7 @@
 #include "contextmode.h"
 #include "enumitem.h"
 #include <string>
+#include <vector>
 
 namespace oofem {
 
@@ -65,6 +66,7 @@ enum FieldType {
 
 class TimeStep;
 class FloatArray;
+class GaussPoint;
 
 /**
  * Abstract class representing field. Field represent the spatial distribution of certain variable.
@@ -109,6 +111,30 @@ public:
      */
     virtual int evaluateAt(FloatArray &answer, DofManager* dman,
                            ValueModeType mode, TimeStep *atTime) = 0;
+    /**
+     * Evaluates the field at given integration point, typically of another domain.
+     * The default implementation evaluates the field at global coordinates of the point.
+     * Fields interpolated over their own domain may cache the location of the point,
+     * as the repeated evaluations (in each iteration of each step) are at the same positions.
+     * @param[out] answer Evaluated field at gp.
+     * @param gp Integration point of interest.
+     * @param mode Mode of value (total, velocity,...).
+     * @param atTime Time step to evaluate for.
+     * @return Zero if ok, nonzero Error code (0-ok, 1-failed)
+     */
+    virtual int evaluateAt(FloatArray &answer, GaussPoint *gp,
+                           ValueModeType mode, TimeStep *atTime);
+    /**
+     * Evaluates the field at all integration points of given domain.
+     * The points are ordered by elements, their integration rules and the points of the rules.
+     * @param[out] answer Evaluated field, one array for each integration point.
+     * @param d Domain of the integration points.
+     * @param mode Mode of value (total, velocity,...).
+     * @param atTime Time step to evaluate for.
+     * @return Zero if ok, nonzero if the evaluation failed in some point.
+     */
+    virtual int evaluateAtIntegrationPoints(std::vector< FloatArray > &answer, Domain *d,
+                                            ValueModeType mode, TimeStep *atTime);
 
     /// Returns the type of receiver
     FieldType giveType() { return type; }
@@ -49,6 +49,17 @@
 #include <initializer_list>
 #endif
 
+/**
+ * Number of coefficients a FloatArray keeps inside the object itself.
+ * Arrays not larger than this (strain and stress vectors in Voigt notation) never touch the heap.
+ * Every FloatArray is larger by this many doubles (48 bytes with the default value), also when it is
+ * empty or its values are on the heap. A status holding several such vectors on the other hand saves
+ * one heap allocation and the malloc bookkeeping per vector. The value can be overridden at compile time.
+ */
+#ifndef FLOATARRAY_SMALL_SIZE
+ #define FLOATARRAY_SMALL_SIZE 6
+#endif
+
 namespace oofem {
 class IntArray;
 class FloatMatrix;
@@ -81,6 +92,8 @@ class CommunicationBuffer;
  * Remarks:
  * - For the sake of efficiency, the array values is allocated using the
  *   C calloc function rather than the 'new' operator.
+ * - Arrays with at most FLOATARRAY_SMALL_SIZE coefficients are stored in
+ *   a buffer inside the object and do not allocate at all.
  * - Method givePointer is an encapsulation crime. It is used only for
  *   speeding up method 'dot' of class RowColumn and for speeding method
  *   initialize.
@@ -94,6 +107,8 @@ protected:
     int allocatedSize;
     /// Stored values of vector.
     double *values;
+    /// Storage used for values while the allocated size is small.
+    double smallValues [ FLOATARRAY_SMALL_SIZE ];
 
 public:
     /**
@@ -49,6 +49,18 @@
 #include <initializer_list>
 #endif
 
+/**
+ * Number of coefficients a FloatMatrix keeps inside the object itself.
+ * Matrices not larger than this (e.g. 3x3 deformation gradients and rotation matrices) never touch the heap.
+ * Every FloatMatrix is larger by this many doubles (72 bytes with the default value), also when it is
+ * empty or its values are on the heap. Larger matrices (material stiffness, element matrices) are allocated
+ * as before, they are mostly temporaries and a bigger buffer would mainly enlarge the matrices stored
+ * in elements and statuses. The value can be overridden at compile time.
+ */
+#ifndef FLOATMATRIX_SMALL_SIZE
+ #define FLOATMATRIX_SMALL_SIZE 9
+#endif
+
 #ifdef BOOST_PYTHON
 namespace boost { namespace python { namespace api {
 class object;
@@ -84,6 +96,8 @@ class CommunicationBuffer;
  *   previously allocated space.
  *   If further request for growing then is necessary memory reallocation.
  *   This process is controlled in resize member function.
+ * - Matrices with at most FLOATMATRIX_SMALL_SIZE coefficients are stored in
+ *   a buffer inside the object and do not allocate at all.
  */
 class FloatMatrix
 {
@@ -96,6 +110,8 @@ protected:
     int allocatedSize;
     /// Values of matrix stored column wise.
     double *values;
+    /// Storage used for values while the allocated size is small.
+    double smallValues [ FLOATMATRIX_SMALL_SIZE ];
 
 public:
     /**
@@ -45,7 +45,8 @@
 #include "integrationpointstatus.h"
 #include "element.h"
 #include "materialmode.h"
-#include "tdictionary.h"
+
+#include <cstddef>
 
 namespace oofem {
 class Material;
@@ -88,6 +89,10 @@ class IntegrationRule;
  * only its element natural coordinates, but also its subVolume local coordinates, that are necessary
  * to compute its jacobian, for example. These coordinates are stored in localCoordinates attribute.
  *
+ * The managed statuses are kept in a small table stored inline in the receiver, so that the status of
+ * the element material (usually the only one) is found without traversing any list. The table grows
+ * on the heap only if more than InlineStatusCapacity statuses are managed.
+ * Slaves are allocated in one contiguous block per master point, see allocateSlaveGaussPoints.
  */
 class GaussPoint
 {
@@ -111,8 +116,38 @@ protected:
     int numberOfGp;
     /// List of slave integration points.
     GaussPoint **gaussPointArray;
-    //Disctionary of managed MaterialStatuses
-    TDictionary<int,IntegrationPointStatus> statusDict;
+    /// Contiguous storage of slaves, NULL if slaves are allocated individually.
+    char *slaveStorage;
+    /// Size of slave stored in slaveStorage.
+    std::size_t slaveSize;
+
+    /// Capacity of inline status table.
+    enum { InlineStatusCapacity = 2 };
+    /// Number of managed statuses.
+    int numberOfStatuses;
+    /// Capacity of status table.
+    int statusCapacity;
+    /// Keys (material numbers) of managed statuses, points to inlineStatusKeys unless table has grown.
+    int *statusKeys;
+    /// Managed statuses, points to inlineStatuses unless table has grown.
+    IntegrationPointStatus **statuses;
+    int inlineStatusKeys [ InlineStatusCapacity ];
+    IntegrationPointStatus *inlineStatuses [ InlineStatusCapacity ];
+
+    /**
+     * Allocates contiguous storage for slaves of receiver. Slaves are then constructed in place
+     * (using placement new) by cross section or material model at addresses given by giveSlaveStorage
+     * and registered in gaussPointArray. They are destroyed by receiver.
+     * @param n Number of slaves.
+     * @param size Size of slave object (sizeof of its class).
+     */
+    void allocateSlaveGaussPoints(int n, std::size_t size);
+    /// Returns address of storage for i-th slave (zero-based), see allocateSlaveGaussPoints.
+    void *giveSlaveStorage(int i) { return slaveStorage + i * slaveSize; }
+
+private:
+    GaussPoint(const GaussPoint &);
+    GaussPoint &operator=(const GaussPoint &);
 
 public:
     /**
@@ -163,8 +198,14 @@ public:
      * Returns reference to associated material status (NULL if not defined).
      * @param n Material number
      */
-    IntegrationPointStatus *giveMaterialStatus(int n) { 
-        return statusDict.at(n); 
+    IntegrationPointStatus *giveMaterialStatus(int n) {
+        for ( int i = 0; i < numberOfStatuses; i++ ) {
+            if ( statusKeys [ i ] == n ) {
+                return statuses [ i ];
+            }
+        }
+
+        return NULL;
     }
     /**
      * Sets Material status managed by receiver.
@@ -172,14 +213,7 @@ public:
      * @param i classID of class storing status
      * @return Pointer to new status.
      */
-    IntegrationPointStatus *setMaterialStatus(IntegrationPointStatus *ptr, int n)
-    {
-        if (this->statusDict.includes(n)) {
-            OOFEM_ERROR (" MaterialStatus::setMaterialStatus status already exist");
-        }
-        this->statusDict.add(n, ptr);
-        return ptr;
-    }
+    IntegrationPointStatus *setMaterialStatus(IntegrationPointStatus *ptr, int n);
     /**
      * Returns index-th slave gauss point of receiver.
      * @param index Index of returned slave.
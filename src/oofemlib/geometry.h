@@ -199,6 +199,8 @@ class Triangle : public BasicGeometry
 {
 public:
     Triangle(FloatArray *p1, FloatArray *p2, FloatArray *p3);
+    /// Creates the triangle from copies of the given vertices.
+    Triangle(const FloatArray &iP1, const FloatArray &iP2, const FloatArray &iP3);
     virtual ~Triangle() { }
 
     virtual BasicGeometry* Clone() {return new Triangle(*this);}
@@ -44,6 +44,7 @@
 #define _IFT_GPExportModule_Name "gp"
 #define _IFT_GPExportModule_vartypes "vars"
 #define _IFT_GPExportModule_ncoords "ncoords"
+#define _IFT_GPExportModule_fields "fields"
 //@}
 
 namespace oofem {
@@ -60,6 +61,8 @@ protected:
     IntArray vartypes;
     /// Number of coordinates to be exported (at each Gauss point)
     int ncoords;
+    /// Types of registered fields (e.g. temperature of a staggered problem) to be exported
+    IntArray fields;
 
 public:
     /// Constructor. Creates empty Output Manager. By default all components are selected.
@@ -115,6 +115,10 @@ public:
     int buildInternalStructure(EngngModel *, int, EquationID, const UnknownNumberingScheme & s);
     int assemble(const IntArray &loc, const FloatMatrix &mat);
     int assemble(const IntArray &rloc, const IntArray &cloc, const FloatMatrix &mat);
+    bool canAssembleConcurrently() const { return true; }
+    bool canUseScatterMaps() const { return true; }
+    virtual void computeScatterMap(IntArray &map, const IntArray &rloc, const IntArray &cloc) const;
+    virtual int assembleScattered(const IntArray &map, const FloatMatrix &mat);
     bool canBeFactorized() const { return false; }
     virtual void zero();
     virtual double &at(int i, int j);
@@ -94,6 +94,7 @@ public:
     int buildInternalStructure(EngngModel *, int, EquationID, const UnknownNumberingScheme &);
     int assemble(const IntArray &loc, const FloatMatrix &mat);
     int assemble(const IntArray &rloc, const IntArray &cloc, const FloatMatrix &mat);
+    bool canAssembleConcurrently() const { return true; }
     bool canBeFactorized() const { return false; }
     virtual void zero();
     SparseMtrxType  giveType() const { return SMT_DynCompCol; }
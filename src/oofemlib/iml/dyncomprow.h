@@ -86,6 +86,11 @@ public:
     int buildInternalStructure(EngngModel *, int, EquationID, const UnknownNumberingScheme &);
     int assemble(const IntArray &loc, const FloatMatrix &mat);
     int assemble(const IntArray &rloc, const IntArray &cloc, const FloatMatrix &mat);
+    bool canAssembleConcurrently() const { return true; }
+    bool canUseScatterMaps() const { return true; }
+    /// Scatter map stores pairs of (row index, column position in row) for each coefficient; cached maps are dropped when the pattern grows.
+    void computeScatterMap(IntArray &map, const IntArray &rloc, const IntArray &cloc) const;
+    int assembleScattered(const IntArray &map, const FloatMatrix &mat);
     bool canBeFactorized() const { return false; }
     void zero();
     SparseMtrxType  giveType() const { return SMT_DynCompRow; }
@@ -107,6 +107,8 @@ public:
     int buildInternalStructure(EngngModel *, int, EquationID, const UnknownNumberingScheme &);
     int assemble(const IntArray &loc, const FloatMatrix &mat);
     int assemble(const IntArray &rloc, const IntArray &cloc, const FloatMatrix &mat);
+    bool canAssembleConcurrently() const { return true; }
+    virtual void computeScatterMap(IntArray &map, const IntArray &rloc, const IntArray &cloc) const;
     bool canBeFactorized() const { return false; }
     virtual void zero();
     virtual double &at(int i, int j);
@@ -37,9 +37,12 @@
 
 #include "femcmpnn.h"
 
+#include <cstddef>
+
 namespace oofem {
 
 class GaussPoint;
+class StatusArena;
 
 /**
  * Abstract base class representing  a integration status.
@@ -88,6 +91,19 @@ public:
     virtual const char *giveClassName() const { return "IntegrationPointStatus"; }
     virtual classType giveClassID() const { return IntegrationPointStatusClass; }
     virtual IRResultType initializeFrom(InputRecord *ir) { return IRRT_OK; }
+
+    /**
+     * @name Allocation
+     * Statuses can be allocated individually on the heap (plain new) or in a status arena
+     * using placement new, e.g. <tt>new(arena) SomeStatus(...)</tt>. A NULL arena falls back to the heap.
+     * Both kinds are released by plain delete.
+     */
+    //@{
+    static void *operator new(std::size_t size);
+    static void *operator new(std::size_t size, StatusArena *arena);
+    static void operator delete(void *p);
+    static void operator delete(void *p, StatusArena *arena);
+    //@}
 };
 } // end namespace oofem
 #endif // integrationpointstatus_h
@@ -64,6 +64,10 @@ public:
                     ValueModeType mode, TimeStep *atTime) ;
     virtual int evaluateAt(FloatArray &answer, DofManager* dman,
                     ValueModeType mode, TimeStep *atTime) ;
+    virtual int evaluateAt(FloatArray &answer, GaussPoint *gp,
+                    ValueModeType mode, TimeStep *atTime) ;
+    virtual int evaluateAtIntegrationPoints(std::vector< FloatArray > &answer, Domain *d,
+                    ValueModeType mode, TimeStep *atTime) ;
 
     virtual contextIOResultType restoreContext(DataStream *stream, ContextMode mode) { return CIO_OK; }
     virtual contextIOResultType saveContext(DataStream *stream, ContextMode mode) { return CIO_OK; }
@@ -37,7 +37,6 @@
 #define masterdof_h
 
 #include "dof.h"
-#include "dictionary.h"
 #include "dofmanager.h"
 
 #include <cstdio>
@@ -64,10 +63,9 @@ class InitialCondition;
  * This parameter is also used in member function giveUnknownType, which returns
  * CharType type according to DofID parameter.
  *
- * I don't know whether to implement following feature (now  not implemented)
- * 'unknowns' and 'pastUnknowns' are the dictionaries where the dof stores
- * its unknowns (e.g., the displacement 'd', the velocity 'v' and the acceleration 'a'),
- * at the current time step and at the previous one.
+ * 'unknownsSlot' is the slot of the receiver in the DOF unknowns store of the
+ * engineering model (see DofUnknownsStore), where the unknowns dictionary of the
+ * receiver is kept, zero if the receiver has not stored any unknown yet.
  *
  * TASKS
  * - Equation numbering, in method 'giveEquationNumber' and 'givePrescribedEquationNumber' ;
@@ -98,8 +96,8 @@ protected:
     int bc;
     /// Initial condition number associated to dof.
     int ic;
-    /// Unknowns dictionary to support changes of static system.
-    Dictionary *unknowns;
+    /// Slot of unknowns dictionary in DOF unknowns store of engineering model, to support changes of static system.
+    int unknownsSlot;
 
 public:
     /**
@@ -115,7 +113,7 @@ public:
     MasterDof(int i, DofManager *aNode, int nbc, int nic, DofIDItem id);
     MasterDof(int i, DofManager *aNode, DofIDItem id = Undef);
     /// Destructor.
-    virtual ~MasterDof()   { delete unknowns; }
+    virtual ~MasterDof();
 
     virtual dofType giveDofType() { return DT_master; }
     virtual const char *giveClassName() const { return "MasterDof"; }
@@ -145,14 +143,14 @@ public:
 
     virtual void giveUnknownsDictionaryValue(TimeStep *tStep, ValueModeType mode, double &dofValue);
 
+    virtual bool hasUnknownsDictionaryValue(TimeStep *tStep, ValueModeType mode);
+
     virtual contextIOResultType saveContext(DataStream *stream, ContextMode mode, void *obj = NULL);
     virtual contextIOResultType restoreContext(DataStream *stream, ContextMode mode, void *obj = NULL);
 
     virtual void setBcId(int bcId) { this->bc = bcId; }
     virtual void setIcId(int icId) { this->ic = icId; }
     virtual void setEquationNumber(int equationNumber) { this->equationNumber = equationNumber; }
-    virtual void setUnknowns(Dictionary *unknowns) { this->unknowns = unknowns; }
-    virtual Dictionary *giveUnknowns() { return this->unknowns; }
     virtual int giveEqn() { return equationNumber; }
 
 protected:
@@ -50,6 +50,7 @@
 //@{
 #define _IFT_Material_density "d"
 #define _IFT_Material_castingtime "castingtime"
+#define _IFT_Material_statusarena "statusarena"
 //@}
 
 namespace oofem {
@@ -57,6 +58,7 @@ namespace oofem {
 
 class GaussPoint;
 class Dictionary;
+class StatusArena;
 class FloatArray;
 class FloatMatrix;
 
@@ -110,15 +112,21 @@ protected:
      */
     double castingTime;
 
+    /**
+     * Arena where statuses of the receiver are allocated, NULL if statuses are allocated individually.
+     * Status classes opt in by allocating themselves in CreateStatus using placement new with this arena.
+     */
+    StatusArena *statusArena;
+
 public:
     /**
      * Constructor. Creates material with given number, belonging to given domain.
      * @param n Material number.
      * @param d Domain to which new material will belong.
      */
-    Material(int n, Domain *d) : FEMComponent(n, d), propertyDictionary(new Dictionary()), castingTime(-1.) { }
+    Material(int n, Domain *d) : FEMComponent(n, d), propertyDictionary(new Dictionary()), castingTime(-1.), statusArena(NULL) { }
     /// Destructor.
-    virtual ~Material() { delete propertyDictionary; }
+    virtual ~Material();
 
     /**
      * Returns true if stiffness matrix of receiver is symmetric
@@ -321,6 +329,8 @@ public:
      */
     virtual MaterialStatus *CreateStatus(GaussPoint *gp) const
     { return NULL; }
+    /// Returns the status arena of the receiver, NULL if statuses are allocated individually on the heap.
+    StatusArena *giveStatusArena() const { return statusArena; }
 
 protected:
     /**
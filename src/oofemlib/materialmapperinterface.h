@@ -37,10 +37,13 @@
 
 #include "interface.h"
 
+#include <vector>
+
 namespace oofem {
 class Domain;
 class Element;
 class TimeStep;
+class GaussPoint;
 
 /**
  * The class representing the general material model adaptive mapping interface.
@@ -70,6 +73,24 @@ public:
      * @return Nonzero if o.k.
      */
     virtual int MMI_map(GaussPoint *gp, Domain *oldd, TimeStep *tStep) = 0;
+    /**
+     * Maps the required internal state variables from old mesh oldd to all given ips in one pass.
+     * The results are stored in gp statuses. The default implementation maps the points one by one,
+     * material models can use the MaterialMappingAlgorithm::mapVariables service to map all points at once.
+     * @param gps Integration points belonging to new domain which values will be mapped.
+     * @param oldd Old mesh reference.
+     * @param tStep Time step.
+     * @return Nonzero if o.k.
+     */
+    virtual int MMI_mapBatch(const std :: vector< GaussPoint * > &gps, Domain *oldd, TimeStep *tStep)
+    {
+        int result = 1;
+        for ( std :: size_t i = 0; i < gps.size(); i++ ) {
+            result &= this->MMI_map(gps [ i ], oldd, tStep);
+        }
+
+        return result;
+    }
     /**
      * Updates the required internal state variables from previously mapped values.
      * The result is stored in gp status. This map and update splitting is necessary,
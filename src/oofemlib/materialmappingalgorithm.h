@@ -40,6 +40,8 @@
 #include "inputrecord.h"
 #include "internalstatetype.h"
 
+#include <vector>
+
 namespace oofem {
 class Domain;
 class Element;
@@ -75,6 +77,10 @@ class DynamicInputRecord;
  * This also assumes that all mappers are are stored as class variables of material model in order to reuse
  * their initialization.
  *
+ * When the material model maps all its integration points at once, the mapVariables service can be used instead.
+ * It maps all requested variables to all given points in one pass, so the mappers can share searches and
+ * patches among neighbouring points and process the points in parallel. Unlike init and mapVariable, it does
+ * not use the state of the receiver set up by previous calls.
  */
 class MaterialMappingAlgorithm
 {
@@ -135,6 +141,19 @@ public:
      * @return Nonzero if o.k.
      */
     virtual int __mapVariable(FloatArray &answer, FloatArray &coords, InternalStateType type, TimeStep *tStep) = 0;
+    /**
+     * Maps the given internal variables from old mesh to all given integration points of new mesh in one pass.
+     * The default implementation initializes the receiver and maps the variables point by point.
+     * @param answer On output, the value of variable varTypes.at(j) in point gps[i] is stored in answer[i*nvar + j - 1],
+     * where nvar is the size of varTypes.
+     * @param gps Integration points belonging to new domain to which mapping occur.
+     * @param dold Old domain.
+     * @param varTypes Array of InternalStateType values, identifying all vars to be mapped.
+     * @param tStep Time step.
+     * @return Nonzero if o.k.
+     */
+    virtual int mapVariables(std :: vector< FloatArray > &answer, const std :: vector< GaussPoint * > &gps,
+                             Domain *dold, IntArray &varTypes, TimeStep *tStep);
     /**
      * Initializes receiver according to object description stored in input record.
      * InitString can be imagined as data record in component database
@@ -149,6 +168,14 @@ public:
     virtual void giveInputRecord(DynamicInputRecord &input) {}
     /// Returns class name of the receiver.
     virtual const char *giveClassName() const  = 0;
+
+protected:
+    /**
+     * Computes the global coordinates of given integration points.
+     * @param answer Global coordinates of points.
+     * @param gps Integration points.
+     */
+    void giveGlobalCoordinates(std :: vector< FloatArray > &answer, const std :: vector< GaussPoint * > &gps);
 };
 } // end namespace oofem
 #endif // materialmappingalgorithm_h
@@ -60,6 +60,9 @@ public:
 
     virtual int __mapVariable(FloatArray &answer, FloatArray &coords, InternalStateType type, TimeStep *tStep);
 
+    virtual int mapVariables(std :: vector< FloatArray > &answer, const std :: vector< GaussPoint * > &gps,
+                             Domain *dold, IntArray &varTypes, TimeStep *tStep);
+
     virtual const char *giveClassName() const { return "MMAClosestIPTransfer"; }
 };
 } // end namespace oofem
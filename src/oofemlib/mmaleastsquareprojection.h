@@ -52,6 +52,7 @@ class Domain;
 class Element;
 class TimeStep;
 class DynamicInputRecord;
+class FloatMatrix;
 
 enum MMALeastSquareProjectionPatchType { MMALSPPatchType_1dq, MMALSPPatchType_2dq };
 /*
@@ -100,6 +101,9 @@ public:
 
     virtual int __mapVariable(FloatArray &answer, FloatArray &coords, InternalStateType type, TimeStep *tStep);
 
+    virtual int mapVariables(std :: vector< FloatArray > &answer, const std :: vector< GaussPoint * > &gps,
+                             Domain *dold, IntArray &varTypes, TimeStep *tStep);
+
     virtual IRResultType initializeFrom(InputRecord *ir);
     virtual void giveInputRecord(DynamicInputRecord &input);
 
@@ -108,6 +112,34 @@ public:
 protected:
     void computePolynomialTerms(FloatArray &P, FloatArray &coords, MMALeastSquareProjectionPatchType type);
     int giveNumberOfUnknownPolynomialCoefficients(MMALeastSquareProjectionPatchType regType);
+    /// Returns the patch type corresponding to given source element.
+    MMALeastSquareProjectionPatchType givePatchType(Element *sourceElement);
+    /**
+     * Determines the elements of patch assembled around given source element.
+     * @param patchList On output, the patch elements.
+     * @param state On output, nonzero if source element is damaged (used with state filter).
+     * @param actualNumberOfPoints On output, the number of integration points in patch.
+     * @param sourceElement Element of old mesh containing the receiver point.
+     * @param ptype Patch type.
+     * @param region Region of receiver point.
+     * @param tStep Time step.
+     * @return Nonzero if patch has enough integration points, zero otherwise.
+     */
+    int initPatchElements(IntArray &patchList, int &state, int &actualNumberOfPoints, Element *sourceElement,
+                          MMALeastSquareProjectionPatchType ptype, int region, TimeStep *tStep);
+    /// Collects the integration points of given patch elements.
+    void givePatchIntegrationPoints(std :: list< GaussPoint * > &answer, const IntArray &patchList, Domain *dold);
+    /**
+     * Computes the least square fit of given variable over the patch points.
+     * @param answer Polynomial coefficients, one column for each component of variable.
+     * @param patch Patch integration points.
+     * @param origin The polynomial is expressed in coordinates relative to this point.
+     * @param ptype Patch type.
+     * @param type Internal variable type.
+     * @param tStep Time step.
+     */
+    void computePatchFit(FloatMatrix &answer, const std :: list< GaussPoint * > &patch, const FloatArray &origin,
+                         MMALeastSquareProjectionPatchType ptype, InternalStateType type, TimeStep *tStep);
 };
 } // end namespace oofem
 #endif // mmaleastsquareprojection_h
@@ -43,6 +43,10 @@
 #include "internalstatetype.h"
 #include "statecountertype.h"
 
+#include <map>
+#include <string>
+#include <vector>
+
 namespace oofem {
 class Domain;
 class Element;
@@ -50,6 +54,48 @@ class CrossSection;
 class TimeStep;
 class CommunicatorBuff;
 class ProblemCommunicator;
+
+/**
+ * Cache of nodal values recovered by the recovery models of a domain (see Domain :: giveNodalRecoveryCache).
+ * The values are identified by the recovery model class, its virtual region mapping and the internal state type,
+ * and only the values of the latest solution state are kept. Recovery models of the same kind used by several
+ * export modules or error estimators of the domain thus share the recovered values instead of repeating the recovery.
+ */
+class NodalRecoveryCache
+{
+public:
+    /// Recovered values of one node and virtual region.
+    struct NodalRecord {
+        int node;
+        int region;
+        FloatArray values;
+    };
+    typedef std :: vector< NodalRecord >RecordList;
+    /// Identification of recovered values; the recovery model class and the internal state type, number of virtual regions and virtual region map.
+    typedef std :: pair< std :: string, std :: vector< int > >KeyType;
+
+protected:
+    /// Recovered values.
+    std :: map< KeyType, RecordList >entries;
+    /// Solution state of cached values.
+    StateCounterType stateCounter;
+
+public:
+    NodalRecoveryCache() : entries(), stateCounter(0) { }
+
+    /**
+     * Returns the cached values with given key, NULL if they are not cached for given solution state.
+     */
+    const RecordList *giveRecords(const KeyType &key, StateCounterType counter) const;
+    /**
+     * Returns empty record list to be filled with the values with given key, recovered for given solution state.
+     * Values of other solution states are dropped.
+     */
+    RecordList &giveNewRecords(const KeyType &key, StateCounterType counter);
+    /// Drops all cached values.
+    void clear() { entries.clear(); }
+};
+
 /**
  * The base class for all recovery models, which perform nodal averaging or projection
  * processes for internal variables typically stored in integration points.
@@ -123,6 +169,8 @@ public:
      * @param tStep Time step.
      */
     virtual int recoverValues(InternalStateType type, TimeStep *tStep) = 0;
+    /// Returns class name of the receiver.
+    virtual const char *giveClassName() const = 0;
     /**
      * Clears the receiver's nodal table.
      * @return nonzero if o.k.
@@ -204,6 +252,25 @@ protected:
      */
     int updateRegionRecoveredValues(const int ireg, const IntArray &regionNodalNumbers,
                                     int regionValSize, const FloatArray &rhs);
+    /**
+     * Gives the key identifying the values of given type, recovered by the receiver, in the domain cache.
+     */
+    void giveCacheKey(NodalRecoveryCache :: KeyType &key, InternalStateType type);
+    /**
+     * Makes the recovered values of given type available in the nodal table, if they are up to date
+     * or they can be restored from the domain cache. Should be called at the beginning of recoverValues.
+     * @param type Determines the type of internal variable.
+     * @param tStep Time step.
+     * @return Nonzero if the values are available and recovery can be skipped, zero otherwise.
+     */
+    int restoreRecoveredValues(InternalStateType type, TimeStep *tStep);
+    /**
+     * Marks the values in nodal table as recovered for given type and time step and stores them into the domain cache.
+     * Should be called at the end of recoverValues.
+     * @param type Determines the type of internal variable.
+     * @param tStep Time step.
+     */
+    void storeRecoveredValues(InternalStateType type, TimeStep *tStep);
 };
 } // end namespace oofem
 #endif // nodalrecoverymodel_h
@@ -38,8 +38,9 @@
 #include "matstatus.h"
 #include "interface.h"
 #include "intarray.h"
+#include "spatiallocalizer.h"
 
-#include <list>
+#include <vector>
 
 ///@name Input fields for NonlocalMaterialExtensionInterface
 //@{
@@ -88,8 +89,8 @@ struct localIntegrationRecord {
 class NonlocalMaterialStatusExtensionInterface : public Interface
 {
 protected:
-    /// List containing localIntegrationRecord values.
-    std::list< localIntegrationRecord >integrationDomainList;
+    /// Contiguous array of localIntegrationRecord values.
+    std::vector< localIntegrationRecord >integrationDomainList;
     /// Nonlocal volume of corresponding integration point.
     double integrationScale;
 
@@ -107,7 +108,7 @@ public:
      * references to integration points and their weights that influence the nonlocal average in
      * receiver's associated integration point.
      */
-    std::list< localIntegrationRecord > *giveIntegrationDomainList() { return & integrationDomainList; }
+    std::vector< localIntegrationRecord > *giveIntegrationDomainList() { return & integrationDomainList; }
     /// Returns associated integration scale.
     double giveIntegrationScale() { return integrationScale; }
     /// Sets associated integration scale.
@@ -249,6 +250,45 @@ public:
      */
     void buildNonlocalPointTable(GaussPoint *gp);
 
+    /**
+     * Builds the missing nonlocal tables of all integration points in the domain at once.
+     * The work is organized per element: a query around the element center, enlarged by
+     * the element extent, provides the candidates for all its integration points. The queries
+     * are issued in batches of limited size and the elements are processed in parallel when OpenMP
+     * is enabled. The coordinates of integration points are computed once per element.
+     * The tables are identical to those of buildNonlocalPointTable. Points of materials which do
+     * not keep their tables permanently or which use the distance based nonlocal variation are skipped.
+     */
+    void buildNonlocalPointTables();
+    /**
+     * Computes the global coordinates of integration points of given elements.
+     * @param ipCoords Coordinates of integration points, indexed by element number (starting from zero).
+     * @param elems Numbers of elements to compute.
+     */
+    void computeIPCoordinates(std :: vector< std :: vector< FloatArray > > &ipCoords, const IntArray &elems);
+    /**
+     * Determines the sphere containing the supports of all integration points of given element,
+     * which miss their nonlocal table.
+     * @param elem Element of interest.
+     * @param gpCoords Global coordinates of integration points of the element.
+     * @param center Center of the sphere.
+     * @param radius Radius of the sphere.
+     */
+    void giveElementNonlocalQueryBox(Element *elem, const std :: vector< FloatArray > &gpCoords, FloatArray &center, double &radius);
+    /**
+     * Builds the missing nonlocal tables of integration points of given element.
+     * @param elem Element of interest.
+     * @param elemSet Candidate elements, having an integration point within the box given by giveElementNonlocalQueryBox.
+     * @param ipCoords Coordinates of integration points of the element and of all candidates (see computeIPCoordinates).
+     */
+    void buildElementNonlocalPointTables(Element *elem, const SpatialLocalizer :: elementContainerType &elemSet,
+                                         const std :: vector< std :: vector< FloatArray > > &ipCoords);
+    /**
+     * Returns the nonlocal status extension of given integration point if its table is missing
+     * and can be built by buildNonlocalPointTables, NULL otherwise.
+     */
+    NonlocalMaterialStatusExtensionInterface *giveMissingNonlocalTableStatus(GaussPoint *gp);
+
     /**
      * Rebuild list of integration points which take part
      * in nonlocal average in given integration point.
@@ -264,7 +304,7 @@ public:
      * receiver's associated integration point.
      * Rebuilds the IP list by calling  buildNonlocalPointTable if not available.
      */
-    std::list< localIntegrationRecord > *giveIPIntegrationList(GaussPoint *gp);
+    std::vector< localIntegrationRecord > *giveIPIntegrationList(GaussPoint *gp);
 
     /**
      * Evaluates the basic nonlocal weight function for a given distance
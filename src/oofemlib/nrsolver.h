@@ -61,6 +61,7 @@
 #define _IFT_NRSolver_ddv "ddv"
 #define _IFT_NRSolver_ddltf "ddltf"
 #define _IFT_NRSolver_linesearch "linesearch"
+#define _IFT_NRSolver_fusedtangent "fusedtangent"
 #define _IFT_NRSolver_rtolv "rtolv"
 #define _IFT_NRSolver_rtolf "rtolf"
 #define _IFT_NRSolver_rtold "rtold"
@@ -131,6 +132,8 @@ private:
     int lsFlag;
     /// Line search solver
     LineSearchNM *linesearchSolver;
+    /// Flag indicating whether internal forces and tangent are requested together when both are needed
+    int fusedTangentFlag;
 
 #ifdef __PETSC_MODULE
     IS prescribedEgsIS;
@@ -47,6 +47,7 @@ enum NumericalCmpn {
     InternalRhs,
     NonLinearLhs,
     NonLinearRhs_Incremental,
+    InternalRhs_NonLinearLhs, ///< Internal forces together with the nonlinear lhs, evaluated for the same state.
 };
 } // end namespace oofem
 #endif // numericalcmpn_h
@@ -36,6 +36,7 @@
 #define octreelocalizer_h
 
 #include "spatiallocalizer.h"
+#include "boundingvolumetree.h"
 #include "floatarray.h"
 #include "alist.h"
 #include "intarray.h"
@@ -180,6 +181,8 @@ public:
  * nodal connectivity informations provided by ConTable.
  * Typical services include searching the closes node to give position, searching of an element containing given point, etc.
  * If special element algorithms required, these should be included using interface concept.
+ * The batch queries do not use the octree, they are answered by flat bounding volume trees
+ * of integration points, nodes and element bounding boxes, which are built on their first use.
  */
 class OctreeSpatialLocalizer : public SpatialLocalizer
 {
@@ -191,6 +194,18 @@ protected:
     /// Flag indicating elementIP tables are initialized.
     bool elementIPListsInitialized;
     IntArray elementListsInitialized;
+    /// Flat tree of integration points of the default integration rules, used by the batch queries.
+    BoundingVolumeTree ipTree;
+    /// Element number and integration point index of each item of ipTree.
+    std :: vector< int >ipTreeElements, ipTreeIPs;
+    /// Flat tree of nodes, used by the batch queries.
+    BoundingVolumeTree nodeTree;
+    /// Node number of each item of nodeTree.
+    std :: vector< int >nodeTreeNodes;
+    /// Flat tree of element bounding boxes, used by the batch queries.
+    BoundingVolumeTree elementTree;
+    /// Element number of each item of elementTree.
+    std :: vector< int >elementTreeElements;
 
 public:
     /// Constructor
@@ -222,6 +237,14 @@ public:
     virtual void giveAllElementsWithIpWithinBox(elementContainerType &elemSet, const FloatArray &coords, const double radius);
     virtual void giveAllNodesWithinBox(nodeContainerType &nodeList, const FloatArray &coords, const double radius);
 
+    virtual void giveElementsContainingPoints(std :: vector< Element * > &answer, const std :: vector< FloatArray > &coords,
+                                              const IntArray *regionList = NULL);
+    virtual void giveClosestIPs(std :: vector< GaussPoint * > &answer, const std :: vector< FloatArray > &coords, int region);
+    virtual void giveAllElementsWithIpWithinBoxes(std :: vector< elementContainerType > &answer,
+                                                  const std :: vector< FloatArray > &coords, const FloatArray &radii);
+    virtual void giveAllNodesWithinBoxes(std :: vector< nodeContainerType > &answer,
+                                         const std :: vector< FloatArray > &coords, const FloatArray &radii);
+
     virtual const char *giveClassName() const { return "OctreeSpatialLocalizer"; }
 
 protected:
@@ -242,6 +265,25 @@ protected:
      * Insert element into tree (the tree topology is determined by nodes).
      */
     void initElementDataStructure(int region = 0);
+    /**
+     * Allocates the node and IP element lists of given cell and of all its children.
+     * The queries only read these lists, so once they exist, the queries do not modify
+     * the tree and can be evaluated concurrently.
+     * @param cell Starting cell.
+     */
+    void initCellLists(OctantRec *cell);
+    /**
+     * Builds the flat tree of integration points of the default integration rules, if not done previously.
+     * The point coordinates are computed in parallel.
+     */
+    void initIPTree();
+    /// Builds the flat tree of nodes, if not done previously.
+    void initNodeTree();
+    /**
+     * Builds the flat tree of bounding boxes of elements providing the SpatialLocalizerInterface,
+     * if not done previously. The boxes are computed in parallel.
+     */
+    void initElementTree();
     /**
      * Finds the terminal octant containing the given point.
      * @param startCell Cell used to start search.
@@ -0,0 +1,133 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef oofembindatareader_h
+#define oofembindatareader_h
+
+#include "datareader.h"
+#include "oofembininputrecord.h"
+
+#include <string>
+
+namespace oofem {
+/**
+ * Class representing the reader of OOFEM input files in binary format.
+ * The binary file is created from the text input file (see convert) and contains the same sequence
+ * of records. The records are already split into tokens and all numeric tokens are converted in advance,
+ * so that the reading avoids the tokenization and the text to number conversions of the text format.
+ * The data are stored in columns (arrays over all tokens of the file):
+ * - first token of each record and its line number in the text file,
+ * - token flags (integer, real number, quoted string),
+ * - integer and real values of tokens,
+ * - offsets of token strings in the string pool,
+ * which are read by a single read operation and used in place.
+ *
+ * The binary data can also be kept in memory (see compile) and read by several readers at once,
+ * which is used to instanciate the same problem many times without parsing its input again.
+ */
+class OOFEMBINDataReader : public DataReader
+{
+public:
+    /// Token flags.
+    enum TokenFlag { TF_Integer = 1, TF_Real = 2, TF_Quoted = 4 };
+
+protected:
+    std::string dataSourceName;
+    /// Contents of the file.
+    const char *data;
+    /// Whether the data are owned by the receiver (read from file) or used in place.
+    bool ownsData;
+
+    long long nrecords;
+    long long ntokens;
+    /// First token of each record (the size is nrecords+1).
+    const long long *recordStart;
+    /// Offset of each token in the string pool.
+    const long long *tokenOffset;
+    /// Real value of each token.
+    const double *realValue;
+    /// Integer value of each token.
+    const int *intValue;
+    /// Line number of each record in the text file.
+    const int *recordLine;
+    /// Flags of each token.
+    const unsigned char *tokenFlags;
+    /// Zero terminated token strings.
+    const char *pool;
+
+    /// Next record to be read.
+    long long current;
+    /// Input record.
+    OOFEMBINInputRecord ir;
+
+public:
+    /// Constructor.
+    OOFEMBINDataReader(const char *inputfilename);
+    /**
+     * Creates a reader of binary data kept in memory (see compile).
+     * The data are used in place, they are not copied and have to outlive the reader.
+     * @param sourceName Name of the data source, used in messages.
+     * @param image Binary data.
+     * @param size Size of the data in bytes.
+     */
+    OOFEMBINDataReader(const char *sourceName, const char *image, long size);
+    virtual ~OOFEMBINDataReader();
+
+    virtual InputRecord *giveInputRecord(InputRecordType, int recordId);
+    virtual void finish();
+    virtual const char *giveDataSourceName() const { return dataSourceName.c_str(); }
+
+    /// Returns true if the given file is in binary format.
+    static bool isBinaryFile(const char *fileName);
+    /**
+     * Converts the input file from text to binary format.
+     * @param txtFileName Input file in text format.
+     * @param binFileName Output file in binary format.
+     */
+    static void convert(const char *txtFileName, const char *binFileName);
+    /**
+     * Converts the input file from text to binary format kept in memory.
+     * @param txtFileName Input file in text format.
+     * @param image The binary data, in the same layout as the binary file.
+     */
+    static void compile(const char *txtFileName, std::string &image);
+
+protected:
+    /// Sets up the columns of the binary data of given size.
+    void setupColumns(long size);
+
+    friend class OOFEMBINInputRecord;
+};
+} // end namespace oofem
+#endif // oofembindatareader_h
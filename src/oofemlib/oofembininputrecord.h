@@ -0,0 +1,127 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef oofembininputrecord_h
+#define oofembininputrecord_h
+
+#include "inputrecord.h"
+
+#include <cstring>
+#include <map>
+#include <vector>
+
+namespace oofem {
+class OOFEMBINDataReader;
+
+/**
+ * Class representing the Input Record for OOFEM binary input file format.
+ * The record is a range of tokens of the binary file, which are already split and
+ * converted to numbers (see OOFEMBINDataReader), so reading the fields does not parse any text.
+ * The semantics of fields is the same as in OOFEMTXTInputRecord.
+ */
+class OOFEMBINInputRecord : public InputRecord
+{
+protected:
+    /// Reader holding the data.
+    const OOFEMBINDataReader *reader;
+    /// Index of first token of the record.
+    long long first;
+    /// Number of tokens of the record.
+    int ntokens;
+    std::vector< bool > readFlag;
+
+    int lineNumber;
+
+    /// Orders the token strings.
+    struct TokenLess {
+        bool operator()(const char *a, const char *b) const { return strcmp(a, b) < 0; }
+    };
+    /**
+     * Index of the first occurrence of each token, which can be a keyword, in the record.
+     * Built on the first keyword lookup in the record; the strings are owned by the reader.
+     */
+    std::map< const char *, int, TokenLess > keywords;
+    /// Whether the keyword index is built.
+    bool keywordsBuilt;
+
+public:
+    /// Constructor. Creates an empty input record.
+    OOFEMBINInputRecord();
+    /// Destructor.
+    virtual ~OOFEMBINInputRecord() { }
+
+    /**
+     * Creates a copy in the text format, which does not depend on the data of the reader.
+     */
+    virtual InputRecord *GiveCopy();
+
+    /// Sets the record to given record of the reader.
+    void setRecord(const OOFEMBINDataReader *reader, long long irec);
+    /// Returns record string.
+    std::string giveRecordAsString();
+
+    void finish(bool wrn = true);
+
+public:
+    virtual IRResultType giveRecordKeywordField(std::string &answer, int &value);
+    virtual IRResultType giveRecordKeywordField(std::string &answer);
+    virtual IRResultType giveField(int &answer, InputFieldType id);
+    virtual IRResultType giveField(double &answer, InputFieldType id);
+    virtual IRResultType giveField(bool &answer, InputFieldType id);
+    virtual IRResultType giveField(std::string &answer, InputFieldType id);
+    virtual IRResultType giveField(FloatArray &answer, InputFieldType id);
+    virtual IRResultType giveField(IntArray &answer, InputFieldType id);
+    virtual IRResultType giveField(FloatMatrix &answer, InputFieldType id);
+    virtual IRResultType giveField(std::vector< std::string > &answer, InputFieldType id);
+    virtual IRResultType giveField(Dictionary &answer, InputFieldType id);
+    virtual IRResultType giveField(std::list< Range > &answer, InputFieldType id);
+
+    virtual bool hasField(InputFieldType id);
+    virtual void printYourself();
+
+    virtual void report_error(const char *_class, const char *proc, InputFieldType id,
+                              IRResultType result, const char *file, int line);
+
+protected:
+    int giveKeywordIndx(const char *kwd);
+    /// Returns i-th token of the record (numbered from 1), NULL if out of record.
+    const char *giveToken(int i);
+    /// Reads i-th token as integer, returns zero if not an integer.
+    int scanInteger(int i, int &value);
+    /// Reads i-th token as real number, returns zero if not a number.
+    int scanDouble(int i, double &value);
+    void setReadFlag(int itok) { readFlag [ itok - 1 ] = true; }
+};
+} // end namespace oofem
+#endif // oofembininputrecord_h
@@ -144,6 +144,8 @@ protected:
      * @return Nonzero on success.
      */
     int readMatrix(const char *helpSource, int r, int c, FloatMatrix &ans);
+
+    friend class OOFEMBINInputRecord;
 };
 } // end namespace oofem
 #endif // oofemtxtinputrecord_h
@@ -38,6 +38,7 @@
 #include "field.h"
 #include "interface.h"
 #include "floatarray.h"
+#include "intarray.h"
 #include "equationid.h"
 #include "unknownnumberingscheme.h"
 #include "valuemodetype.h"
@@ -49,6 +50,7 @@
 namespace oofem {
 class PrimaryField;
 class Dof;
+class GaussPoint;
 
 /**
  * Element interface class. Declares the functionality required to support PrimaryField element interpolation.
@@ -75,6 +77,19 @@ public:
      */
     virtual int EIPrimaryFieldI_evaluateFieldVectorAt(FloatArray &answer, PrimaryField &pf,
         FloatArray &coords, IntArray &dofId, ValueModeType mode, TimeStep *atTime) = 0;
+    /**
+     * Evaluates the value of field at given local coordinates of the receiver using element interpolation.
+     * Allows to evaluate the field repeatedly at the same point without locating it again.
+     * @param answer Field evaluated at the point.
+     * @param pf Field to use for evaluation.
+     * @param lcoords Local coordinates of the point in the receiver.
+     * @param dofId IDs of DOFs to evaluate.
+     * @param mode Mode of field.
+     * @param atTime Time step to evaluate at.
+     * @return Zero if ok, nonzero when error encountered or when not supported by the element (the default).
+     */
+    virtual int EIPrimaryFieldI_evaluateFieldVectorAtLocalCoords(FloatArray &answer, PrimaryField &pf,
+        const FloatArray &lcoords, IntArray &dofId, ValueModeType mode, TimeStep *atTime) { return 1; }
     //@}
 };
 
@@ -107,6 +122,36 @@ protected:
     int domainIndx;
     EquationID ut;
 
+    /**
+     * Location of integration points of another domain in the receiver's domain.
+     * For each point the background element and the local coordinates in it are kept, so that
+     * repeated evaluations at the point need neither its global coordinates nor the spatial localizer.
+     * The points are ordered by elements, their integration rules and the points of the rules.
+     * The mapping is valid as long as both domains keep their serial numbers and the elements keep
+     * their integration rules, it assumes that the meshes do not move with respect to each other.
+     */
+    struct IPMapping {
+        /// Problem and number of the domain of the integration points (the domain itself may be replaced by a clone).
+        EngngModel *model;
+        int domainNumber;
+        /// Serial numbers of the domain and of the receiver's domain, when the mapping was created.
+        int serialNumber, fieldSerialNumber;
+        /// Receiver's domain, when the mapping was created.
+        Domain *fieldDomain;
+        /// Position of the first point of each element (size number of elements + 1).
+        IntArray offsets;
+        /// Mapped integration points.
+        std::vector< GaussPoint * > points;
+        /// Natural coordinates of the points in their own elements, to detect re-created integration rules.
+        std::vector< FloatArray > gpcoords;
+        /// Background elements of the points, zero if the point is outside the receiver's domain.
+        IntArray elements;
+        /// Local coordinates of the points in background elements.
+        std::vector< FloatArray > lcoords;
+    };
+    /// Cached mappings, one for each domain evaluated at.
+    std::vector< IPMapping * > ipMappings;
+
 public:
     /**
      * Constructor. Creates a field of given type associated to given domain.
@@ -181,6 +226,36 @@ public:
      */
     virtual int __evaluateAt(FloatArray &answer, FloatArray& coords,
                     ValueModeType mode, TimeStep *atTime, IntArray *dofId);
+    /**
+     * Evaluates the field at given integration point, allows to select specific
+     * dofs using mask. The location of the point is cached, see IPMapping.
+     * @param answer Evaluated field at gp.
+     * @param gp Integration point of interest.
+     * @param mode Mode of evaluated unknowns.
+     * @param atTime Time step of interest.
+     * @param dofId Dof mask, id set to NULL, all Dofs evaluated.
+     * @return Error code (0=ok, 1=point not found in domain)
+     */
+    virtual int __evaluateAt(FloatArray &answer, GaussPoint *gp,
+                    ValueModeType mode, TimeStep *atTime, IntArray *dofId);
+    /**
+     * Evaluates the field at all integration points of given domain, allows to select specific
+     * dofs using mask.
+     * @param answer Evaluated field, one array for each integration point.
+     * @param d Domain of the integration points.
+     * @param mode Mode of evaluated unknowns.
+     * @param atTime Time step of interest.
+     * @param dofId Dof mask, id set to NULL, all Dofs evaluated.
+     * @return Error code (0=ok, 1=some point not found in domain)
+     */
+    virtual int __evaluateAtIntegrationPoints(std::vector< FloatArray > &answer, Domain *d,
+                    ValueModeType mode, TimeStep *atTime, IntArray *dofId);
+    virtual int evaluateAt(FloatArray &answer, GaussPoint *gp,
+                           ValueModeType mode, TimeStep *atTime);
+    virtual int evaluateAtIntegrationPoints(std::vector< FloatArray > &answer, Domain *d,
+                                            ValueModeType mode, TimeStep *atTime);
+    /// Drops the cached locations of integration points, see IPMapping.
+    void clearIntegrationPointMappings();
     /**
      * @param atTime Time step to take solution for.
      * @return Solution vector for requested time step.
@@ -210,6 +285,18 @@ public:
 protected:
     int resolveIndx(TimeStep *atTime, int shift);
     virtual FloatArray *giveSolutionVector(int);
+    /**
+     * Returns valid mapping of integration points of given domain, creates it if necessary.
+     * @param d Domain of the integration points.
+     * @param checkPoints If true, the mapping is rebuilt also when the integration rules of the elements
+     * no longer hold the mapped points.
+     * @param checkElem If given, the mapping is rebuilt when the integration rules of this element
+     * no longer hold its mapped points.
+     */
+    IPMapping *giveIntegrationPointMapping(Domain *d, bool checkPoints, Element *checkElem = NULL);
+    /// Evaluates the field at i-th point of the mapping.
+    int evaluateAtMappedPoint(FloatArray &answer, IPMapping *map, int i,
+                              ValueModeType mode, TimeStep *atTime, IntArray *dofId);
 };
 
 } // end namespace oofem
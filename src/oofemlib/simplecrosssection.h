@@ -101,6 +101,11 @@ public:
     virtual void giveRealStress_Shell(FloatArray &answer, GaussPoint *gp, const FloatArray &generalizedStrain, TimeStep *tStep);
     virtual void giveRealStress_MembraneRot(FloatArray &answer, GaussPoint *gp, const FloatArray &generalizedStrain, TimeStep *tStep);
 
+    virtual void giveRealStressesBatch(FloatMatrix &answer, const std::vector< GaussPoint * > &gps,
+                                       const FloatMatrix &reducedStrains, TimeStep *tStep);
+    virtual void giveFirstPKStressesBatch(FloatMatrix &answer, const std::vector< GaussPoint * > &gps,
+                                          const FloatMatrix &reducedFs, TimeStep *tStep);
+
 
     virtual void giveCharMaterialStiffnessMatrix(FloatMatrix &answer, MatResponseMode rMode, GaussPoint *gp, TimeStep *tStep);
     virtual bool isCharacteristicMtrxSymmetric(MatResponseMode rMode, int mat);
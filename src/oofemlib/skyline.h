@@ -103,6 +103,10 @@ public:
 
     virtual int assemble(const IntArray &loc, const FloatMatrix &mat);
     virtual int assemble(const IntArray &rloc, const IntArray &cloc, const FloatMatrix &mat);
+    virtual bool canAssembleConcurrently() const { return true; }
+    virtual bool canUseScatterMaps() const { return true; }
+    virtual void computeScatterMap(IntArray &map, const IntArray &rloc, const IntArray &cloc) const;
+    virtual int assembleScattered(const IntArray &map, const FloatMatrix &mat);
 
     virtual bool canBeFactorized() const { return true; }
     virtual SparseMtrx *factorized();
@@ -43,6 +43,16 @@
 #include "sparsemtrxtype.h"
 #include "unknownnumberingscheme.h"
 
+#include <vector>
+
+#ifndef SPARSEMTRX_OMP_MIN_SIZE
+/**
+ * Matrices with fewer rows are multiplied by a single thread even when compiled with OpenMP;
+ * below this size the cost of forking the threads exceeds the work of the product.
+ */
+ #define SPARSEMTRX_OMP_MIN_SIZE 2000
+#endif
+
 namespace oofem {
 class EngngModel;
 class TimeStep;
@@ -78,20 +88,56 @@ protected:
      * matrix, if there is no change;
      */
     SparseMtrxVersionType version;
+    /**
+     * Set while several threads assemble into the receiver (see beginConcurrentAssembly).
+     * The version is then incremented once by endConcurrentAssembly instead of by each contribution.
+     */
+    bool concurrentAssembly;
+
+    /**
+     * Cached scatter maps of element contributions (frozen pattern mode), indexed by element number.
+     * Empty entries have not been computed yet. Must be cleared whenever the internal structure changes.
+     */
+    std::vector< IntArray > scatterMaps;
+    /// Set when the pattern grew during a concurrent assembly; the scatter maps are then dropped by endConcurrentAssembly.
+    bool scatterMapsInvalid;
 
 public:
     /**
      * Constructor, creates (n,m) sparse matrix. Due to sparsity character of matrix,
      * not all coefficient are physically stored (in general, zero members are omitted).
      */
-    SparseMtrx(int n, int m) : nRows(n), nColumns(m), version(0) { }
+    SparseMtrx(int n, int m) : nRows(n), nColumns(m), version(0), concurrentAssembly(false), scatterMapsInvalid(false) { }
     /// Constructor
-    SparseMtrx() : nRows(0), nColumns(0), version(0) { }
+    SparseMtrx() : nRows(0), nColumns(0), version(0), concurrentAssembly(false), scatterMapsInvalid(false) { }
     /// Destructor
     virtual ~SparseMtrx() { }
 
     /// Return receiver version.
     SparseMtrxVersionType giveVersion() { return this->version; }
+    /**
+     * Increments receiver version, to be called after any change of the receiver.
+     * During concurrent assembly nothing is done, the version is incremented once by endConcurrentAssembly.
+     */
+    void incrementVersion() {
+        if ( !this->concurrentAssembly ) {
+            this->version++;
+        }
+    }
+    /**
+     * Marks the start of an assembly in which several threads add contributions to the receiver.
+     * Must be called before the threads are started.
+     */
+    void beginConcurrentAssembly() { this->concurrentAssembly = true; }
+    /// Marks the end of a concurrent assembly and increments the receiver version.
+    void endConcurrentAssembly() {
+        this->concurrentAssembly = false;
+        this->version++;
+        if ( this->scatterMapsInvalid ) {
+            this->scatterMaps.clear();
+            this->scatterMapsInvalid = false;
+        }
+    }
 
     /**
      * Checks size of receiver towards requested bounds.
@@ -206,6 +252,69 @@ public:
      */
     virtual int assemble(const IntArray &rloc, const IntArray &cloc, const FloatMatrix &mat) = 0;
 
+    /**
+     * Determines whether assemble may be called concurrently from several threads.
+     * The caller must guarantee that simultaneous contributions share no row and no column
+     * (e.g. by coloring the elements, see EngngModel::giveElementColoring).
+     * This holds for formats that keep separate storage for each row/column and do not alter
+     * shared data during assembly. Concurrent calls leave the version unchanged (see beginConcurrentAssembly).
+     */
+    virtual bool canAssembleConcurrently() const { return false; }
+
+    /**
+     * @name Frozen pattern mode.
+     * Once the internal structure is built, the storage position of each coefficient of an element contribution
+     * does not change until the structure is rebuilt. These positions (the scatter map) can be cached per element,
+     * so that repeated assembly is a plain indexed add, with no location array and no index search.
+     */
+    //@{
+    /// Determines whether receiver supports scatter maps.
+    virtual bool canUseScatterMaps() const { return false; }
+    /**
+     * Computes the scatter map of a contribution given by its location arrays.
+     * The map is opaque; it is only meant to be passed to assembleScattered of the same receiver.
+     * All nonzero locations must be within the pattern built by buildInternalStructure.
+     * @param map Scatter map.
+     * @param rloc Row location array.
+     * @param cloc Column location array.
+     */
+    virtual void computeScatterMap(IntArray &map, const IntArray &rloc, const IntArray &cloc) const { OOFEM_ERROR("SparseMtrx :: computeScatterMap - Not implemented"); }
+    /**
+     * Assembles contribution using its scatter map.
+     * @param map Scatter map computed by computeScatterMap.
+     * @param mat Contribution to be assembled.
+     * @return Nonzero iff successful.
+     */
+    virtual int assembleScattered(const IntArray &map, const FloatMatrix &mat) { OOFEM_ERROR("SparseMtrx :: assembleScattered - Not implemented"); return 0; }
+    /**
+     * Prepares the scatter map cache for given number of elements.
+     * Keeps already computed maps if the number of elements is unchanged.
+     * Must not be called concurrently with giveScatterMap.
+     */
+    void initScatterMaps(int nelem) {
+        if ( ( int ) scatterMaps.size() != nelem ) {
+            scatterMaps.clear();
+            scatterMaps.resize(nelem);
+        }
+    }
+    /// Returns the cached scatter map of given element (empty if not computed yet).
+    IntArray &giveScatterMap(int ielem) { return scatterMaps [ ielem - 1 ]; }
+    /**
+     * Drops all cached scatter maps, to be called when positions of existing entries change.
+     * During concurrent assembly the maps are only marked and dropped by endConcurrentAssembly.
+     */
+    void invalidateScatterMaps() {
+        if ( !this->concurrentAssembly ) {
+            this->scatterMaps.clear();
+        } else {
+#ifdef _OPENMP
+ #pragma omp atomic write
+#endif
+            this->scatterMapsInvalid = true;
+        }
+    }
+    //@}
+
     /// Starts assembling the elements.
     virtual int assembleBegin() { return 1; }
     /// Returns when assemble is completed.
@@ -41,6 +41,7 @@
 
 #include <set>
 #include <list>
+#include <vector>
 
 namespace oofem {
 class Domain;
@@ -198,6 +199,46 @@ public:
      */
     virtual void giveAllNodesWithinBox(nodeContainerType &nodeList, const FloatArray &coords, const double radius) = 0;
 
+    /**
+     * @name Batch queries.
+     * Answer the corresponding single point query for each of the given points.
+     * The default implementations simply loop over the points; localizers able to
+     * answer the queries concurrently distribute the points among threads.
+     */
+    //@{
+    /**
+     * Batch version of giveElementContainingPoint.
+     * @param answer Elements containing the points, NULL for points outside of the domain.
+     * @param coords Global coordinates of points of interest.
+     * @param regionList Only elements within given regions are considered, if NULL all regions are considered.
+     */
+    virtual void giveElementsContainingPoints(std :: vector< Element * > &answer, const std :: vector< FloatArray > &coords,
+                                              const IntArray *regionList = NULL);
+    /**
+     * Batch version of giveClosestIP.
+     * @param answer Closest integration points to given points.
+     * @param coords Global coordinates of points of interest.
+     * @param region If value > 0 then only points from given region are considered.
+     */
+    virtual void giveClosestIPs(std :: vector< GaussPoint * > &answer, const std :: vector< FloatArray > &coords, int region);
+    /**
+     * Batch version of giveAllElementsWithIpWithinBox.
+     * @param answer Containers of elements having integration point within the corresponding box.
+     * @param coords Centers of boxes of interest.
+     * @param radii Radii of bounding spheres.
+     */
+    virtual void giveAllElementsWithIpWithinBoxes(std :: vector< elementContainerType > &answer,
+                                                  const std :: vector< FloatArray > &coords, const FloatArray &radii);
+    /**
+     * Batch version of giveAllNodesWithinBox.
+     * @param answer Containers of nodes within the corresponding box.
+     * @param coords Centers of boxes of interest.
+     * @param radii Radii of bounding spheres.
+     */
+    virtual void giveAllNodesWithinBoxes(std :: vector< nodeContainerType > &answer,
+                                         const std :: vector< FloatArray > &coords, const FloatArray &radii);
+    //@}
+
     /**
      * Initialize receiver data structure if not done previously
      * If force is set to true, the initialization is enforced (useful if domain geometry has changed)
@@ -81,6 +81,8 @@ public:
 
     int recoverValues(InternalStateType type, TimeStep *tStep);
 
+    virtual const char *giveClassName() const { return "SPRNodalRecoveryModel"; }
+
 private:
     /**
      * Initializes the region table indicating regions to skip.
@@ -92,7 +94,16 @@ private:
     void initRegionMap(IntArray &regionMap, IntArray &regionTypes, InternalStateType type);
 
     void determinePatchAssemblyPoints(IntArray &pap, int ireg, SPRPatchType regType);
-    void initPatch(IntArray &patchElems, IntArray &dofManToDetermine, IntArray &pap, int papNumber, int ireg);
+    /**
+     * Determines the elements of patch assembled around given assembly point and the dofManagers,
+     * which values are determined from this patch.
+     * @param patchElems On output, the elements of patch.
+     * @param dofManToDetermine On output, the dofManagers to determine from patch.
+     * @param papInv Nonzero entry for each dofManager, which is a patch assembly point.
+     * @param papNumber Patch assembly point.
+     * @param ireg Virtual region number.
+     */
+    void initPatch(IntArray &patchElems, IntArray &dofManToDetermine, const IntArray &papInv, int papNumber, int ireg);
     void computePatch(FloatMatrix &a, IntArray &patchElems, int &regionValSize,
                       SPRPatchType regType, InternalStateType type, TimeStep *tStep);
     void determineValuesFromPatch(FloatArray &dofManValues, IntArray &dofManCount,
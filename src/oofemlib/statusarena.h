@@ -0,0 +1,121 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+#ifndef statusarena_h
+#define statusarena_h
+
+#include <cstddef>
+#include <vector>
+
+namespace oofem {
+/**
+ * Alignment of arena slots in bytes. It equals the alignment of max_align_t on common 64-bit platforms,
+ * which is what malloc guarantees, so statuses with members of any fundamental type
+ * (including long double and SSE vectors) are properly aligned.
+ */
+#define STATUSARENA_ALIGNMENT 16
+
+/**
+ * Chunked memory pool for integration point statuses.
+ * Statuses of equal size are placed next to each other in large blocks, which replaces
+ * one heap allocation per integration point by one allocation per block and keeps the
+ * statuses of one material close in memory when they are swept (e.g. in updateYourself at the end of step).
+ * Released slots are recycled by subsequent allocations of the same size.
+ *
+ * The arena is typically owned by a material, see Material::giveStatusArena. Since statuses may outlive
+ * their material (the order of destruction is not guaranteed in general), the owner does not delete
+ * the arena directly but calls detach; the memory is returned to the system once the last slot is released.
+ * Statuses are allocated in the arena using placement new, see IntegrationPointStatus::operator new.
+ * Slot sizes are rounded up to a multiple of STATUSARENA_ALIGNMENT and blocks come from malloc,
+ * so every slot is aligned to STATUSARENA_ALIGNMENT.
+ */
+class StatusArena
+{
+protected:
+    /// Pool of slots of one size.
+    struct Pool {
+        /// Slot size in bytes.
+        std::size_t slotSize;
+        /// Allocated blocks.
+        std::vector< char * > blocks;
+        /// Head of the linked list of free slots.
+        void *freeSlot;
+    };
+
+    /// Pools, one for each requested slot size.
+    std::vector< Pool > pools;
+    /// Number of slots allocated together in one block.
+    int slotsPerBlock;
+    /// Number of slots in use.
+    int nLiveSlots;
+    /// Flag indicating that the owner no longer needs the arena.
+    bool detached;
+
+public:
+    /**
+     * Constructor.
+     * @param slotsPerBlock Number of slots allocated together.
+     */
+    StatusArena(int slotsPerBlock = 256);
+    /// Destructor.
+    ~StatusArena();
+
+    /**
+     * Returns a slot of given size.
+     * @param size Requested size in bytes.
+     * @return Pointer to uninitialized memory of size bytes.
+     */
+    void *allocate(std::size_t size);
+    /**
+     * Returns a slot obtained from allocate back to the arena.
+     * @param p Pointer to the slot.
+     * @param size Size in bytes used when allocating the slot.
+     */
+    void release(void *p, std::size_t size);
+    /**
+     * Called by the owner when the arena is not needed anymore. The arena deletes itself
+     * immediately, if there are no live slots, otherwise when the last slot is released.
+     */
+    void detach();
+
+    /**
+     * Returns the size of slot used for given request, the size is rounded up to a multiple of STATUSARENA_ALIGNMENT.
+     * @param size Requested size in bytes.
+     */
+    static std::size_t giveSlotSize(std::size_t size);
+
+    /// Returns the number of slots in use.
+    int giveNumberOfLiveSlots() const { return nLiveSlots; }
+};
+} // end namespace oofem
+#endif // statusarena_h
@@ -44,6 +44,7 @@
 #include "internalstatevaluetype.h"
 #include "integrationrule.h"
 #include "xfemmanager.h"
+#include "vtkxmlwriter.h"
 
 
 
@@ -65,6 +66,8 @@
 #define _IFT_VTKXMLExportModule_regionstoskip "regionstoskip"
 #define _IFT_VTKXMLExportModule_nvr "nvr"
 #define _IFT_VTKXMLExportModule_vrmap "vrmap"
+#define _IFT_VTKXMLExportModule_format "format"
+#define _IFT_VTKXMLExportModule_async "async"
 //@}
 
 namespace oofem {
@@ -99,6 +102,9 @@ public:
  * some internal variables at region boundaries.
  * Each region is usually exported as a single piece. When region contains composite cells, these are assumed to be
  * exported in individual subsequent pieces after the default one for the particular region.
+ * The data arrays are written in ascii, or as raw or zlib compressed binary data in the appended section (see VTKXMLWriter),
+ * in which case the files can be written in the background while the computation continues.
+ * In parallel, the pieces of all processes are collected in a *.pvtu-file.
  */
 class VTKXMLExportModule : public ExportModule
 {
@@ -145,7 +151,7 @@ public:
     /**
      * Prints point data header.
      */
-    void exportPointDataHeader(FILE *fileStream, TimeStep *tStep);
+    void exportPointDataHeader(TimeStep *tStep);
     void giveDataHeaders(std :: string &pointHeader, std :: string &cellHeader, TimeStep *tStep); // returns the headers
     /// Returns the internal smoother.
     NodalRecoveryModel *giveSmoother();
@@ -155,8 +161,6 @@ public:
     //Experimental // JB
     #ifdef __VTK_MODULE
         vtkSmartPointer<vtkUnstructuredGrid> fileStream;
-    #else
-        FILE *fileStream;
     #endif
 
 
@@ -168,8 +172,10 @@ protected:
     /// Returns the filename for the given time step.
     std::string giveOutputFileName(TimeStep *tStep);
 
-    /// Returns the output stream for given solution step.
-    FILE *giveOutputStream(TimeStep *tStep);
+#ifndef __VTK_MODULE
+    /// Writer of the output file, determines the format of data arrays.
+    VTKXMLWriter writer;
+#endif
     /**
      * Returns corresponding element cell_type.
      * Some common element types are supported, others can be supported via interface concept.
@@ -286,14 +292,6 @@ void exportCellVars(int region, TimeStep *tStep);
 //
 //  Exports a single cell variable (typically an internal variable).
 //
-void exportCellVarAs(InternalStateType type, int region,
-#ifdef __VTK_MODULE
-                         vtkSmartPointer<vtkUnstructuredGrid> &this->fileStream,
-#else
-                         FILE *fileStream,
-#endif
-                         TimeStep *tStep);
-
 void exportCellVarAs(InternalStateType type, int region, TimeStep *tStep);
 
     /**
@@ -318,6 +316,12 @@ void exportCellVarAs(InternalStateType type, int region, TimeStep *tStep);
      * Writes a VTK collection file where time step data is stored.
      */
     void writeVTKCollection();
+#ifdef __PARALLEL_MODE
+    /**
+     * Writes a VTK parallel unstructured grid file (*.pvtu), collecting the pieces written by all processes in given time step.
+     */
+    void writePVTUFile(TimeStep *tStep);
+#endif
 
 
 
@@ -330,10 +334,9 @@ void exportCellVarAs(InternalStateType type, int region, TimeStep *tStep);
     void exportCompositeElement(FILE *fileStream, Element *el, TimeStep *tStep);
     void exportCompositeElement(Element *el, TimeStep *tStep);
 
-    void exportNodalVarAs(InternalStateType type, int nodeVarNum, FILE *fileStream, TimeStep *tStep);
     void exportNodalVarAs(InternalStateType type, int nodeVarNum, TimeStep *tStep);
 
-    void exportCellVarAs(InternalStateType type, std::vector<FloatArray> &cellVars, FILE *fileStream, TimeStep *tStep);
+    void exportCellVarAs(InternalStateType type, std::vector<FloatArray> &cellVars, TimeStep *tStep);
 
     void giveCompositeExportData();
 
@@ -0,0 +1,152 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef vtkxmlwriter_h
+#define vtkxmlwriter_h
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#ifdef __ASYNC_OUTPUT
+ #include <thread>
+#endif
+
+namespace oofem {
+
+/**
+ * Writes the markup and the data arrays of a single VTK XML file.
+ * In the ascii format, everything is printed directly to the file as it comes.
+ * In the appended formats, the markup and the binary array data are collected in memory and the arrays are
+ * written into the AppendedData section when the file is closed, where the header of each array gets its offset.
+ * Optionally, the encoding (including the zlib compression) and the writing of the collected file is left to a background
+ * thread, so that the caller can continue with the computation while the file is written (requires __ASYNC_OUTPUT, otherwise
+ * the file is written when closed). At most one file is being written in the background at a time; the next file is not opened
+ * before the previous one is finished. Errors of the background writing are reported when the writer waits for it.
+ */
+class VTKXMLWriter
+{
+public:
+    /// Encoding of the data arrays.
+    enum DataFormat {
+        DF_ASCII = 0,       ///< Inline ascii data.
+        DF_Appended = 1,    ///< Raw binary data in the appended section.
+        DF_AppendedZLib = 2 ///< Zlib compressed binary data in the appended section.
+    };
+    /// Type of the values in a data array.
+    enum DataType { DT_Float64, DT_Int32, DT_UInt8 };
+
+protected:
+    /// Data array collected for the appended section.
+    struct DataArray {
+        /// Attributes of the array header (without the offset).
+        std :: string attributes;
+        /// Position of the array header in the markup.
+        std :: size_t position;
+        /// Raw values.
+        std :: vector< char >data;
+    };
+
+    /// Collected file in appended formats, handed over as a whole to the writing thread.
+    struct AppendedFile {
+        FILE *stream;
+        bool compress;
+        std :: string markup;
+        std :: vector< DataArray >arrays;
+    };
+
+    /// Format of the data arrays.
+    DataFormat format;
+    /// Determines whether the appended files are written by a background thread.
+    bool async;
+    /// Output stream of the opened file.
+    FILE *stream;
+    /// Collected file, if format is appended.
+    AppendedFile *file;
+    /// Type of the values of the current data array.
+    DataType currentType;
+    /// Name of the last opened file.
+    std :: string fileName;
+#ifdef __ASYNC_OUTPUT
+    /// Thread writing the previously closed file.
+    std :: thread *pending;
+#endif
+    /// Set by the writing thread if the previously closed file could not be written.
+    bool pendingFailed;
+
+public:
+    VTKXMLWriter();
+    /// Destructor. Waits for the pending file to be written.
+    ~VTKXMLWriter();
+
+    /**
+     * Sets the format of the data arrays.
+     * The zlib compression falls back to raw appended data if compiled without zlib support,
+     * the background writing is not used if compiled without __ASYNC_OUTPUT.
+     */
+    void setFormat(DataFormat format, bool async = false);
+    DataFormat giveFormat() const { return format; }
+
+    /// Opens the file with given name. Waits for the previously closed file to be written.
+    void open(const std :: string &fileName);
+    /// Prints the markup.
+    void print(const char *format, ...);
+    /// Prints the VTKFile start tag of given data set type, with the attributes required by the data format.
+    void beginVTKFile(const char *type);
+    /**
+     * Starts a data array.
+     * @param type Type of values.
+     * @param name Name of array, omitted if NULL.
+     * @param ncomponents Number of components, omitted if zero.
+     */
+    void beginDataArray(DataType type, const char *name, int ncomponents);
+    /// Writes a value to the current data array, converted to the type of the array.
+    void writeValue(double val);
+    /// Ends the current data array.
+    void endDataArray();
+    /// Closes the VTKFile element and the file. In appended formats, the data arrays are written (possibly in the background) first.
+    void close();
+    /// Waits until the pending file is written. Reports an error if it could not be written.
+    void wait();
+
+protected:
+    /**
+     * Encodes the collected arrays and writes the whole appended file. The file is deleted afterwards.
+     * @return False if the compression or the writing failed.
+     */
+    static bool writeAppendedFile(AppendedFile *file);
+    /// Writes the file in the background, the failure is stored in given flag.
+    static void writePendingFile(AppendedFile *file, bool *failed);
+};
+} // end namespace oofem
+#endif // vtkxmlwriter_h
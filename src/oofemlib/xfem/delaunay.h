@@ -43,11 +43,17 @@ class FloatArray;
 class Triangle;
 
 /**
- * O(n4) algorithm, only for testing purposes.
- * @author chamrova
+ * Delaunay triangulation of a planar point set, used for the xfem element subdivision.
+ *
+ * The triangulation is built incrementally (Bowyer-Watson): the points are inserted in
+ * lexicographic order, the convex hull edges being closed by ghost triangles sharing a
+ * symbolic vertex at infinity. Each point is located by walking from the last created triangle and the triangles whose
+ * circumcircle contains it are replaced by a fan around the point. Orientation tests are
+ * evaluated exactly, the incircle test is filtered, and the cavity is kept star-shaped
+ * with respect to the inserted point, so that no inverted or degenerate triangle is ever
+ * created. The expected cost is O(n log n), compared to O(n^4) of the original algorithm.
  *
- *  // Yes, but 4th order in n. For the xfem element subdivision, n does not increase when the mesh is refined. Time
- *	// will tell if it is too slow ... /ES
+ * @author chamrova
  * @author Erik Svenning
  */
 class Delaunay
@@ -58,6 +64,10 @@ public:
     bool colinear(FloatArray *p1, FloatArray *p2, FloatArray *p3);
     void printTriangles(AList< Triangle > *triangles);
     bool isInsideCC(FloatArray *p, FloatArray *p1, FloatArray *p2, FloatArray *p3);
+    /**
+     * Computes the Delaunay triangulation of the given vertices. The triangles are appended to oTriangles
+     * ordered by their (sorted) vertex indices, with anticlockwise orientation; colinear triples are skipped.
+     */
     void triangulate(const std :: vector< FloatArray > &iVertices, std::vector< Triangle > &oTriangles);
 
 private:
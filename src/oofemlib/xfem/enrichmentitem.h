@@ -54,6 +54,7 @@
 #define _IFT_EnrichmentItem_function "enrichmentfunction"
 #define _IFT_EnrichmentItem_front "enrichmentfront"
 #define _IFT_EnrichmentItem_propagationlaw "propagationlaw"
+#define _IFT_EnrichmentItem_narrowBandWidth "narrowband"
 
 #define _IFT_Delamination_Name "delamination"
 #define _IFT_Delamination_xiCoord "delaminationxicoord"
@@ -174,6 +175,13 @@ public:
     virtual void updateNodeEnrMarker(XfemManager &ixFemMan, const DofManList &iDofManList);
     virtual void updateNodeEnrMarker(XfemManager &ixFemMan, const WholeDomain &iWholeDomain);
 
+    /**
+     * Restricts the next update of enrichment markers and enriched dofs to the nodes within the
+     * narrow band around the paths of the tips, moved from iOldTips to iNewTips. The band is
+     * enlarged by the radius of the enrichment front.
+     */
+    void setNarrowBand(const std :: vector< TipInfo > &iOldTips, const std :: vector< TipInfo > &iNewTips);
+
     void createEnrichedDofs();
 
     virtual void computeIntersectionPoints(std :: vector< FloatArray > &oIntersectionPoints, std :: vector< int > &oIntersectedEdgeInd, Element *element);
@@ -185,6 +193,8 @@ public:
 
     // Help functions
     double calcXiZeroLevel(const double &iQ1, const double &iQ2) const;
+    /// Number of edges of the element intersected by the interface, zero if the level set does not change sign in the element.
+    int giveNumEdgeIntersections(Element &iEl) const;
     static void calcPolarCoord(double &oR, double &oTheta, const FloatArray &iOrigin, const FloatArray &iPos, const FloatArray &iN, const FloatArray &iT);
 
 protected:
@@ -234,6 +244,27 @@ protected:
 
     const double mLevelSetTol, mLevelSetTol2;
 
+    /**
+     * Width of the band around moved tips within which the enrichment markers and enriched dofs
+     * are updated when the fronts propagate. Outside the band, the previous values are kept;
+     * the level sets are always updated in all nodes. Zero (default) means that the whole domain is updated.
+     */
+    double mNarrowBandWidth;
+
+    /// True if the next update is restricted to the narrow band.
+    bool mUseNarrowBand;
+
+    /// Sorted indices of the nodes in the narrow band.
+    std :: vector< int >mBandNodes;
+
+    /// Sorted indices of the nodes whose enriched dofs may change in a narrow band update.
+    std :: vector< int >mBandDofMans;
+
+    /// Sorted indices of the elements with exactly one intersected edge, i.e. the candidates for containing a tip.
+    std :: vector< int >mTipElements;
+
+    void updateLevelSetsInNode(Domain &iDomain, int iNodeInd);
+
 };
 
 
@@ -385,6 +416,13 @@ public:
 
     virtual bool giveElementTipCoord(FloatArray &oCoord, int iElIndex) const;
 
+    /**
+     * Distance from the tips within which MarkNodesAsFront may mark nodes. Used to enlarge the narrow band
+     * of the enrichment item. A negative value (default) means that nodes may be marked anywhere in the
+     * domain, which disables the narrow band update.
+     */
+    virtual double giveFrontRadius() const { return -1.0; }
+
 protected:
     std::vector<TipInfo> mTipInfo;
 
@@ -420,6 +458,7 @@ public:
     virtual IRResultType initializeFrom(InputRecord *ir) {return IRRT_OK;}
     virtual void giveInputRecord(DynamicInputRecord &input);
 
+    virtual double giveFrontRadius() const { return 0.0; }
 };
 
 class EnrFrontExtend: public EnrichmentFront{
@@ -466,6 +505,8 @@ public:
     virtual IRResultType initializeFrom(InputRecord *ir);
     virtual void giveInputRecord(DynamicInputRecord &input);
 
+    virtual double giveFrontRadius() const { return mEnrichmentRadius; }
+
 private:
 	double mEnrichmentRadius;
 	LinElBranchFunction *mpBranchFunc;
@@ -72,6 +72,8 @@ public:
 
     virtual int recoverValues(InternalStateType type, TimeStep *tStep);
 
+    virtual const char *giveClassName() const { return "ZZNodalRecoveryModel"; }
+
 private:
     /**
      * Initializes the region table indicating regions to skip.
@@ -80,6 +82,20 @@ private:
      * @param type Determines the type of internal variable to be recovered.
      */
     void initRegionMap(IntArray &regionMap, InternalStateType type);
+    /**
+     * Assembles the contributions of given element to the lumped projection of given region.
+     * Elements outside the region or not implementing the interface are skipped.
+     * @param lhs Lumped @f$ N^{\mathrm{T}}N @f$ matrix of region.
+     * @param rhs Product @f$ N^{\mathrm{T}}\alpha @f$ of region.
+     * @param regionValSize Size of recovered record, determined from the element when zero.
+     * @param ielem Element number.
+     * @param ireg Virtual region number.
+     * @param regionNodalNumbers Local region number of each dofManager.
+     * @param type Determines the type of internal variable to be recovered.
+     * @param tStep Time step.
+     */
+    void assembleElementContributions(FloatArray &lhs, FloatMatrix &rhs, int &regionValSize, int ielem, int ireg,
+                                      const IntArray &regionNodalNumbers, InternalStateType type, TimeStep *tStep);
 
 #ifdef __PARALLEL_MODE
     void initCommMaps();
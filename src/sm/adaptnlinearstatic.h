@@ -145,6 +145,16 @@ public:
 protected:
     void assembleInitialLoadVector(FloatArray &loadVector, FloatArray &loadVectorOfPrescribed,
                                    AdaptiveNonLinearStatic *sourceProblem, int domainIndx, TimeStep *atTime);
+    /**
+     * Maps the internal state of all integration points of new domain from old domain.
+     * The integration points are grouped by material, each material maps all its points at once
+     * (see MaterialModelMapperInterface::MMI_mapBatch).
+     * @param dNew New domain.
+     * @param dOld Old domain.
+     * @param tStep Time step.
+     * @return Nonzero if o.k., zero if mapping failed or some element material does not support mapping.
+     */
+    int mapInternalState(Domain *dNew, Domain *dOld, TimeStep *tStep);
     //void assembleCurrentTotalLoadVector (FloatArray& loadVector, FloatArray& loadVectorOfPrescribed,
     //            AdaptiveNonLinearStatic* sourceProblem, int domainIndx, TimeStep* atTime);
 };
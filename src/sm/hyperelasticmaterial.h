@@ -86,6 +86,18 @@ public:
 
     virtual void giveRealStressVector_3d(FloatArray &answer, GaussPoint *gp,
                                       const FloatArray &reducedStrain, TimeStep *tStep);
+    /// Evaluates the closed form stress of all points in one loop without temporary matrices.
+    virtual void giveRealStressVectorBatch(FloatMatrix &answer, const std::vector< GaussPoint * > &gps,
+                                           const FloatMatrix &reducedStrains, TimeStep *tStep);
+    /// Converts the deformation gradients to Green-Lagrange strains and uses the batched second Piola-Kirchhoff stress.
+    virtual void giveFirstPKStressVectorBatch(FloatMatrix &answer, const std::vector< GaussPoint * > &gps,
+                                              const FloatMatrix &reducedFs, TimeStep *tStep);
+
+protected:
+    /// Returns true if the closed form batch evaluation applies to all given points (3d mode, no derived material).
+    bool isBatchUniform(const std::vector< GaussPoint * > &gps);
+
+public:
     
     virtual MaterialStatus *CreateStatus(GaussPoint *gp) const;
 
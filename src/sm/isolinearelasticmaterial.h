@@ -146,6 +146,14 @@ public:
     virtual void give1dStressStiffMtrx(FloatMatrix & answer,
                                MatResponseMode, GaussPoint * gp,
                                TimeStep * atTime);
+
+    /**
+     * The stiffness depends only on the material mode, the stresses of a batch of points in the same mode are therefore
+     * evaluated as a single matrix product. Only the stress independent strains are gathered pointwise.
+     * Derived materials and mixed batches use the pointwise evaluation.
+     */
+    virtual void giveRealStressVectorBatch(FloatMatrix &answer, const std::vector< GaussPoint * > &gps,
+                                           const FloatMatrix &reducedStrains, TimeStep *tStep);
     /**
      * Creates new copy of associated status (StructuralMaterialStatus class )
      * and inserts it into given integration point.
@@ -37,6 +37,7 @@
 
 #include "microplanematerial_bazant.h"
 #include "structuralms.h"
+#include "floatmatrix.h"
 
 ///@name Input fields for M4Material
 //@{
@@ -55,16 +56,37 @@
 
 namespace oofem {
 /**
- * Related material model status to BazantMBCMaterial class
- * for storing history  variables in particular integration point
- * (microplane). Unique copy for each microplane must exist.
+ * Related material model status to M4Material class
+ * for storing history variables in particular (macro) integration point.
+ * History variables of all microplanes are kept by the status in matrices
+ * with one row per microplane and columns corresponding to volumetric, normal,
+ * l-shear and m-shear components, so each component is stored contiguously.
  */
 class M4MaterialStatus : public StructuralMaterialStatus
 {
+protected:
+    /// Equilibrated microplane strains.
+    FloatMatrix microplaneStrains;
+    /// Equilibrated microplane stresses.
+    FloatMatrix microplaneStresses;
+    /// Temporary microplane strains.
+    FloatMatrix tempMicroplaneStrains;
+    /// Temporary microplane stresses.
+    FloatMatrix tempMicroplaneStresses;
+
 public:
-    M4MaterialStatus(int n, Domain *d, GaussPoint *g);
+    M4MaterialStatus(int n, Domain *d, GaussPoint *g, int nmp);
     virtual ~M4MaterialStatus();
 
+    /// Returns equilibrated microplane strains.
+    FloatMatrix &giveMicroplaneStrains() { return microplaneStrains; }
+    /// Returns equilibrated microplane stresses.
+    FloatMatrix &giveMicroplaneStresses() { return microplaneStresses; }
+    /// Returns temporary microplane strains.
+    FloatMatrix &giveTempMicroplaneStrains() { return tempMicroplaneStrains; }
+    /// Returns temporary microplane stresses.
+    FloatMatrix &giveTempMicroplaneStresses() { return tempMicroplaneStresses; }
+
     // definition
     virtual const char *giveClassName() const { return "M4MaterialStatus"; }
     virtual classType giveClassID() const { return M4MaterialStatusClass; }
@@ -80,6 +102,9 @@ public:
 /**
  * Implementation of microplane material model according to Bazant's boundary curve
  * approach.
+ * Microplane laws are evaluated for all microplanes of integration point at once
+ * (see giveRealMicroplaneStresses), microplane history is kept by M4MaterialStatus
+ * of the macro integration point and no microplane slaves are created.
  */
 class M4Material : public MicroplaneMaterial_Bazant
 {
@@ -102,14 +127,17 @@ public:
     /// Destructor.
     virtual ~M4Material() { }
 
-    virtual void giveStiffnessMatrix(FloatMatrix &answer,
-                                          MatResponseMode mode,
-                                          GaussPoint *gp,
-                                          TimeStep *tStep);
+    virtual void give3dMaterialStiffnessMatrix(FloatMatrix &answer,
+                                               MatResponseMode mode,
+                                               GaussPoint *gp,
+                                               TimeStep *tStep);
 
     virtual void giveThermalDilatationVector(FloatArray &answer, GaussPoint *gp, TimeStep *tStep);
 
     virtual void giveRealMicroplaneStressVector(FloatArray &answer, Microplane *mplane, const FloatArray &strain, TimeStep *tStep);
+    virtual void giveRealMicroplaneStresses(double *sv, double *sn, double *sl, double *sm, GaussPoint *gp,
+                                            double ev, const double *en, const double *el, const double *em,
+                                            TimeStep *tStep);
 
     double macbra(double x);
     double FVplus(double ev, double k1, double c13, double c14, double c15, double Ev);
@@ -122,6 +150,10 @@ public:
               double c11, double c12, double Et);
 
     virtual void updateVolumetricStressTo(Microplane *mPlane, double sigv);
+    virtual void updateVolumetricStressesTo(GaussPoint *gp, double sigv);
+
+    virtual contextIOResultType saveIPContext(DataStream *stream, ContextMode mode, GaussPoint *gp);
+    virtual contextIOResultType restoreIPContext(DataStream *stream, ContextMode mode, GaussPoint *gp);
 
     virtual int hasMaterialModeCapability(MaterialMode mode);
 
@@ -130,8 +162,11 @@ public:
     virtual const char *giveClassName() const { return "M4Material"; }
     virtual classType giveClassID() const { return M4MaterialClass; }
 
+    virtual MaterialStatus *CreateStatus(GaussPoint *gp) const { return new M4MaterialStatus(1, domain, gp, numberOfMicroplanes); }
+
 protected:
-    MaterialStatus *CreateMicroplaneStatus(GaussPoint *gp) { return new M4MaterialStatus(1, domain, gp); }
+    MaterialStatus *CreateMicroplaneStatus(GaussPoint *gp) { return NULL; }
+    virtual void initTempStatus(GaussPoint *gp);
 };
 } // end namespace oofem
 #endif // m4_h
@@ -288,6 +288,7 @@ public:
     virtual Interface *giveInterface(InterfaceType it);
 
     virtual int MMI_map(GaussPoint *gp, Domain *oldd, TimeStep *tStep);
+    virtual int MMI_mapBatch(const std :: vector< GaussPoint * > &gps, Domain *oldd, TimeStep *tStep);
     virtual int MMI_update(GaussPoint *gp, TimeStep *tStep, FloatArray *estrain = NULL);
     virtual int MMI_finish(TimeStep *tStep);
 
@@ -88,6 +88,14 @@ protected:
      */
     double L [ MAX_NUMBER_OF_MICROPLANES ] [ 6 ];
 
+    /**
+     * Projection tensors stored by components (NComponents [ i ] [ mPlane ] = N [ mPlane ] [ i ]),
+     * so that loops over microplanes run over contiguous memory.
+     */
+    double NComponents [ 6 ] [ MAX_NUMBER_OF_MICROPLANES ];
+    double MComponents [ 6 ] [ MAX_NUMBER_OF_MICROPLANES ];
+    double LComponents [ 6 ] [ MAX_NUMBER_OF_MICROPLANES ];
+
 public:
 
     /**
@@ -138,6 +146,16 @@ public:
      */
     void computeStrainVectorComponents(FloatArray &answer, Microplane *mplane,
                                        const FloatArray &macroStrain);
+    /**
+     * Computes the normal and shear (l and m direction) components of macro strain
+     * vector on all microplanes at once.
+     * @param en Normal components, array of numberOfMicroplanes values.
+     * @param el Shear components in l direction.
+     * @param em Shear components in m direction.
+     * @param macroStrain Macro strain vector.
+     */
+    void computeMicroplaneStrainComponents(double *en, double *el, double *em,
+                                           const FloatArray &macroStrain);
 
 
     /**
@@ -61,6 +61,8 @@ public:
 
     virtual void giveRealStressVector(FloatArray &answer, GaussPoint *gp,
                                       const FloatArray &reducedStrain, TimeStep *tStep);
+    virtual void giveRealStressVector_3d(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedE, TimeStep *tStep)
+    { this->giveRealStressVector(answer, gp, reducedE, tStep); }
 
 
     /**
@@ -68,6 +70,36 @@ public:
      */
     virtual void updateVolumetricStressTo(Microplane *mPlane, double sigv) = 0;
 
+    /**
+     * Computes real stresses on all microplanes of given macro integration point.
+     * Default implementation evaluates giveRealMicroplaneStressVector on each microplane,
+     * models may override it to evaluate the microplane laws as loops over microplanes.
+     * @param sv Volumetric stresses, array of numberOfMicroplanes values.
+     * @param sn Normal stresses.
+     * @param sl Shear stresses in l direction.
+     * @param sm Shear stresses in m direction.
+     * @param gp Macro integration point.
+     * @param ev Volumetric strain (the same on all microplanes).
+     * @param en Normal strains.
+     * @param el Shear strains in l direction.
+     * @param em Shear strains in m direction.
+     * @param tStep Time step.
+     */
+    virtual void giveRealMicroplaneStresses(double *sv, double *sn, double *sl, double *sm, GaussPoint *gp,
+                                            double ev, const double *en, const double *el, const double *em,
+                                            TimeStep *tStep);
+    /**
+     * Updates the volumetric stress component on all microplanes of given macro integration point.
+     * Default implementation calls updateVolumetricStressTo on each microplane.
+     */
+    virtual void updateVolumetricStressesTo(GaussPoint *gp, double sigv);
+
+    /**
+     * Adds to answer the homogenized (not yet multiplied by 6) macro stress from given
+     * deviatoric normal and shear stresses on microplanes.
+     */
+    void homogenizeMicroplaneStresses(FloatArray &answer, const double *sd, const double *sl, const double *sm);
+
     virtual const char *giveClassName() const { return "MicroplaneMaterial_Bazant"; }
     virtual classType giveClassID() const { return MicroplaneMaterial_BazantClass; }
 
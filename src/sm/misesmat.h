@@ -139,6 +139,13 @@ public:
 
     virtual void giveFirstPKStressVector_3d(FloatArray &answer, GaussPoint *gp, const FloatArray &vF, TimeStep *tStep);
 
+    /**
+     * Batched radial return in 3d. The elastic predictor and the yield check run as one loop over all points,
+     * only the points found to be plastic are corrected individually. Other modes use the pointwise update.
+     */
+    virtual void giveRealStressVectorBatch(FloatMatrix &answer, const std::vector< GaussPoint * > &gps,
+                                           const FloatMatrix &reducedStrains, TimeStep *tStep);
+
 protected:
     void computeGLPlasticStrain(const FloatMatrix &F, FloatMatrix &Ep, FloatMatrix b, double J);
 
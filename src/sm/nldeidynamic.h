@@ -37,10 +37,13 @@
 
 #include "structengngmodel.h"
 #include "floatarray.h"
+#include "intarray.h"
 #include "floatmatrix.h"
 #include "sparselinsystemnm.h"
 #include "sparsemtrxtype.h"
 
+#include <vector>
+
 #define LOCAL_ZERO_MASS_REPLACEMENT 1
 
 ///@name Input fields for NlDEIDynamic
@@ -54,6 +57,7 @@
 #define _IFT_NlDEIDynamic_nodecutmode "nodecutmode"
 #define _IFT_NlDEIDynamic_elementcutmode "elementcutmode"
 #define _IFT_NlDEIDynamic_nonlocalext "nonlocalext"
+#define _IFT_NlDEIDynamic_subcycling "subcycling"
 //@}
 
 namespace oofem {
@@ -90,6 +94,15 @@ namespace oofem {
  * - Additional mode has been introduced remote element mode. It introduces the "remote" elements, the
  *   exact local mirrors of remote counterparts. Introduced to support general nonlocal constitutive models,
  *   in order to provide efficient way, how to average local data without need of fine grain communication.
+ *
+ * Optionally, the elements can be integrated with different time steps (subcycling). The elements are
+ * grouped into levels by their own critical time step, the elements of level l are integrated with time step
+ * deltaT/2^l, where deltaT is the (major) time step of the problem. Each equation is integrated with the step of
+ * the finest element it belongs to. Between their updates, the internal forces of coarser elements are kept constant.
+ * The elements update their state after each of their substeps, history dependent materials thus follow the strain path
+ * of the substeps (the time step seen by materials is the major one).
+ * The external loads are evaluated once per major step. Subcycling is not supported together with dynamic relaxation
+ * and in parallel mode.
  */
 class NlDEIDynamic : public StructuralEngngModel
 {
@@ -127,6 +140,29 @@ protected:
     /// Product of p^tM^(-1)p; where p is reference load vector.
     double pMp;
     
+    /// Maximum subcycling level (zero if subcycling is not used).
+    int maxSubcyclingLevel;
+    /// Highest subcycling level of elements, the major step is divided into 2^subcyclingLevels substeps.
+    int subcyclingLevels;
+    /// Subcycling level of each equation.
+    IntArray equationLevel;
+    /// Equations of each subcycling level.
+    std::vector< IntArray > levelEquations;
+    /// Equations to which the elements of each subcycling level contribute.
+    std::vector< IntArray > levelElementEquations;
+    /// Elements of each subcycling level, split by the element coloring.
+    std::vector< std::vector< IntArray > > levelColors;
+    /// Internal forces of elements of each subcycling level.
+    std::vector< FloatArray > levelInternalForces;
+
+#ifdef __PARALLEL_MODE
+    /**
+     * Weights of equations in the reductions over the partition (dof based norms, load factor).
+     * Zero for equations of remote and null dof managers, 1/(number of sharing partitions) for shared ones.
+     */
+    FloatArray equationWeights;
+#endif
+
     SparseMtrx * massMatrixConsistent;
     LinSystSolverType solverType;
     SparseMtrxType sparseMtrxType;
@@ -182,9 +218,59 @@ protected:
      * @param mass Assembled mass matrix.
      * @param maxOm Estimate of eigenfrequency.
      * @param tStep Time step.
+     * @param elementMaxOm If given, the estimates of eigenfrequency of individual elements are stored there.
      */
-    void computeMassMtrx(FloatArray &mass, double &maxOm, TimeStep *tStep);
+    void computeMassMtrx(FloatArray &mass, double &maxOm, TimeStep *tStep, FloatArray *elementMaxOm = NULL);
     void computeMassMtrx2(FloatMatrix &mass, double &maxOm, TimeStep *tStep);
+    /**
+     * Assembles the internal forces, like giveInternalForces, but the element loop runs in parallel when compiled with OpenMP.
+     * Elements of the same color (see EngngModel::giveElementColoring) share no equation, so they are assembled
+     * concurrently without locking. Nonlocal averages are updated for the whole domain before the element loop.
+     * @param answer Internal forces.
+     * @param tStep Solution step.
+     */
+    void computeInternalForces(FloatArray &answer, TimeStep *tStep);
+    /**
+     * Computes the internal forces of given element and assembles them into answer.
+     * This is the body of the element loop in computeInternalForces.
+     */
+    void assembleElementInternalForces(FloatArray &answer, int ielem, TimeStep *tStep);
+    /**
+     * Updates the local values entering the nonlocal averages (if any), before the internal forces are evaluated concurrently.
+     * @param tStep Solution step.
+     * @param minLevel If positive, only the elements of subcycling levels minLevel and higher are updated.
+     */
+    void updateNonlocalAverages(TimeStep *tStep, int minLevel = 0);
+    /**
+     * Groups the elements and equations into subcycling levels, by the eigenfrequency estimates of elements.
+     * The major time step is reduced if the elements require more than maxSubcyclingLevel levels.
+     * @param elementMaxOm Estimates of eigenfrequency of elements.
+     * @param tStep Time step.
+     */
+    void setUpSubcycling(const FloatArray &elementMaxOm, TimeStep *tStep);
+    /**
+     * Solves the major time step by subcycling. Equivalent to the central difference step of solveYourselfAt
+     * when all elements belong to level 0.
+     * @param tStep Time step.
+     */
+    void solveSubcycledStep(TimeStep *tStep);
+    /**
+     * Evaluates the internal forces of elements of levels minLevel and higher (see levelInternalForces).
+     * @param minLevel Lowest level to be evaluated.
+     * @param tStep Time step.
+     */
+    void computeLevelInternalForces(int minLevel, TimeStep *tStep);
+    /**
+     * Updates the elements of levels minLevel and higher to the state reached in the substep,
+     * so that history dependent materials follow the strain path of the substeps.
+     * @param minLevel Lowest level to be updated.
+     * @param tStep Time step.
+     */
+    void updateLevelElements(int minLevel, TimeStep *tStep);
+#ifdef __PARALLEL_MODE
+    /// Sets up the equationWeights from the parallel modes of dof managers.
+    void computeEquationWeights();
+#endif
 
 #ifdef __PARALLEL_MODE
 public:
@@ -159,6 +159,7 @@ public:
     virtual int isIncremental() { return 1; }
     virtual fMode giveFormulation() { return nonLinFormulation; }
     virtual int useNonlocalStiffnessOption() { return this->nonlocalStiffnessFlag; }
+    virtual bool supportsInternalRhs_NonLinearLhs() { return stiffMode == nls_tangentStiffness; }
     /// For load balancing purposes we store all values so hash is computed from mode value only
     virtual int giveUnknownDictHashIndx(ValueModeType mode, TimeStep *stepN) { return ( int ) mode; }
 
@@ -181,6 +182,14 @@ public:
 protected:
     virtual void assemble(SparseMtrx *answer, TimeStep *tStep, EquationID ut, CharType type,
                   const UnknownNumberingScheme &, Domain *domain);
+    /**
+     * Adds the nonlocal contributions of elements to the tangent stiffness matrix (see nonlocalStiffnessFlag).
+     * @param answer Tangent stiffness matrix.
+     * @param s Equation numbering.
+     * @param domain Domain of elements.
+     * @param tStep Solution step.
+     */
+    void assembleNonlocalStiffnessContributions(SparseMtrx *answer, const UnknownNumberingScheme &s, Domain *domain, TimeStep *tStep);
     void proceedStep(int di, TimeStep *tStep);
     virtual void updateLoadVectors(TimeStep *tStep);
     virtual void computeExternalLoadReactionContribution(FloatArray &reactions, TimeStep *tStep, int di);
@@ -38,6 +38,10 @@
 #include "structuralelement.h"
 #include "domain.h"
 #include "floatmatrix.h"
+#include "floatarray.h"
+#include "statecountertype.h"
+
+#include <vector>
 
 ///@name Input fields for NLStructuralElement
 //@{
@@ -91,6 +95,26 @@ protected:
     /// Flag indicating if geometrical nonlinearities apply.
     int nlGeometry;
 
+    /// Total displacement vector of receiver (initial displacements subtracted) gathered for the solution state below.
+    FloatArray cachedDisplacements;
+    /// Deformation gradients at integration points, indexed by integration rule and point, valid for the same solution state.
+    std::vector< std::vector< FloatArray > > cachedDeformationGradients;
+    /// Time step for which the cached values were computed.
+    TimeStep *cacheTimeStep;
+    /// Number of the time step for which the cached values were computed.
+    int cacheTimeStepNumber;
+    /// Target time of the time step for which the cached values were computed.
+    double cacheTargetTime;
+    /// Solution state counter for which the cached values were computed.
+    StateCounterType cacheStateCounter;
+
+    /// Flag indicating that the internal forces evaluation records its B (or BH) matrices, see computeInternalForcesAndTangent.
+    bool recordBMatrices;
+    /// Integration points of the default rule and their B (or BH) matrices and volumes, recorded by the internal forces evaluation.
+    std::vector< GaussPoint * > recordedGps;
+    std::vector< FloatMatrix > recordedBs;
+    FloatArray recordedVolumes;
+
 public:
     /**
      * Constructor. Creates element with given number, belonging to given domain.
@@ -120,6 +144,15 @@ public:
      * @param tStep Time step.
      */
     void computeFirstPKStressVector(FloatArray &answer, GaussPoint *gp, TimeStep *tStep);
+    /**
+     * Computes the first Piola-Kirchhoff stresses of several integration points at once
+     * for the given deformation gradients, the batch is passed to the cross section.
+     * @param answer Computed stress vectors in Voigt form, one column per integration point.
+     * @param gps Integration points of the receiver.
+     * @param vFs Deformation gradients in Voigt form, one column per integration point.
+     * @param tStep Time step.
+     */
+    void computeFirstPKStressVectorBatch(FloatMatrix &answer, const std::vector< GaussPoint * > &gps, const FloatMatrix &vFs, TimeStep *tStep);
 
     /**
      * Computes the Cauchy stress tensor on Voigt format. This method will
@@ -197,6 +230,15 @@ public:
      */
     void giveInternalForcesVector_withIRulesAsSubcells(FloatArray &answer, TimeStep *tStep, int useUpdatedGpRecord = 0);
 
+    /**
+     * Evaluates internal forces and stiffness matrix by the same calls as the separate evaluation
+     * (giveCharacteristicVector and giveCharacteristicMatrix), so the results are identical.
+     * The B (or BH) matrices and volumes of integration points of the default rule, computed
+     * for the internal forces, are recorded and reused by computeStiffnessMatrix.
+     * Elements overriding either evaluation simply don't share them.
+     */
+    virtual void computeInternalForcesAndTangent(FloatArray &forces, FloatMatrix &tangent, CharType mtrx, TimeStep *tStep);
+
     /**
      * Computes the deformation gradient in Voigt form at integration point ip and at time
      * step tStep. Computes the displacement gradient and adds an identitiy tensor.
@@ -206,10 +248,33 @@ public:
      * @param tStep Time step.
      */
     void computeDeformationGradientVector(FloatArray &answer, GaussPoint *gp, TimeStep *tStep);
+    /**
+     * Computes the deformation gradient from an already evaluated BH matrix, see computeBHmatrixAt.
+     * The result is stored in the integration point cache of the receiver.
+     * @param answer Deformation gradient vector
+     * @param gp Gauss point.
+     * @param tStep Time step.
+     * @param BH Displacement gradient matrix at gp.
+     */
+    void computeDeformationGradientVector(FloatArray &answer, GaussPoint *gp, TimeStep *tStep, const FloatMatrix &BH);
+
+    /**
+     * Returns the total displacement vector of the receiver at given time step, with initial
+     * displacements subtracted. The vector is gathered from the dofs only once per solution state,
+     * the cached copy is reused until the time step or its solution state counter changes.
+     * @param tStep Time step.
+     * @return Reference to the cached displacement vector.
+     */
+    const FloatArray &giveDisplacementVector(TimeStep *tStep);
+    /// Invalidates cached displacement vector and deformation gradients.
+    void invalidateDisplacementCache();
+
+    virtual void updateYourself(TimeStep *tStep);
 
     // data management
     virtual IRResultType initializeFrom(InputRecord *ir);
     virtual void giveInputRecord(DynamicInputRecord &input);
+    virtual contextIOResultType restoreContext(DataStream *stream, ContextMode mode, void *obj = NULL);
 
     // definition
     virtual const char *giveClassName() const { return "NLStructuralElement"; }
@@ -226,6 +291,9 @@ protected:
      */
 
 
+    /// Returns the cache slot for deformation gradient at given integration point, NULL if it is not cached.
+    FloatArray *giveDeformationGradientSlot(GaussPoint *gp);
+
     void computeStressStiffness(FloatMatrix &answer, FloatArray &S, MaterialMode matMode);
     int giveVoigtIndexSym(int ind1, int ind2);
     void giveSymPartOf(const FloatArray &A, FloatArray &answer);
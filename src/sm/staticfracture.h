@@ -38,7 +38,7 @@
 #include "metastep.h"
 #include "xfemmanager.h"
 #include "fracturemanager.h"
-#include "Element.h"
+#include "element.h"
 
 #include "engngm.h"
 
@@ -39,6 +39,7 @@
 
 namespace oofem {
 class StructuralElement;
+class NonlocalMaterialExtensionInterface;
 
 /**
  * This class implements extension of EngngModel for structural models.
@@ -85,6 +86,38 @@ protected:
      * @param tStep Solution step.
      */
     virtual void giveInternalForces(FloatArray &answer, bool normFlag, int di, TimeStep *tStep);
+    /**
+     * Evaluates the nodal representation of internal forces together with the stiffness matrix of given type.
+     * Both are obtained from the elements in one call (see StructuralElement::computeInternalForcesAndTangent),
+     * so that elements may share the work on integration points. The tangent is zeroed by the caller.
+     * @param answer Vector of nodal internal forces.
+     * @param tangent Sparse matrix where the element stiffness matrices are assembled.
+     * @param type Type of stiffness matrix.
+     * @param normFlag True if element by element norm of internal forces (internalForcesEBENorm) is to be computed.
+     * @param di Domain number.
+     * @param tStep Solution step.
+     */
+    void giveInternalForcesAndTangent(FloatArray &answer, SparseMtrx *tangent, CharType type, bool normFlag, int di, TimeStep *tStep);
+    /**
+     * Assembles the internal forces and the stiffness matrix of a single element (see giveInternalForcesAndTangent).
+     * Elements sharing no dofs can be assembled concurrently.
+     * @param answer Vector of nodal internal forces.
+     * @param tangent Sparse matrix where the element stiffness matrix is assembled.
+     * @param type Type of stiffness matrix.
+     * @param eNorms Element by element norms of internal forces, summed by dof types (if not NULL).
+     * @param ielem Element number.
+     * @param tStep Solution step.
+     * @param domain Domain of element.
+     */
+    void assembleElementInternalForcesAndTangent(FloatArray &answer, SparseMtrx *tangent, CharType type,
+                                                 FloatArray *eNorms, int ielem, TimeStep *tStep, Domain *domain);
+    /**
+     * Returns the nonlocal extension of the first nonlocal material in the domain.
+     * Its averaging can be updated for the whole domain in advance, before the elements are evaluated concurrently.
+     * @param domain Domain to search.
+     * @return Nonlocal extension, NULL if there is no nonlocal material.
+     */
+    NonlocalMaterialExtensionInterface *giveNonlocalMaterialExtension(Domain *domain);
 
     /**
      * Updates nodal values
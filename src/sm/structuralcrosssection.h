@@ -105,6 +105,18 @@ public:
     virtual void giveRealStress_MembraneRot(FloatArray &answer, GaussPoint *gp, const FloatArray &generalizedStrain, TimeStep *tStep) = 0;
     //@}
 
+    /**
+     * Computes the real stresses of several integration points of one element at once.
+     * The points have to share the material mode. The default implementation evaluates
+     * giveRealStresses point by point.
+     * @param answer Stress vectors, one column per integration point.
+     * @param gps Integration points.
+     * @param reducedStrains Strain vectors in reduced form, one column per integration point.
+     * @param tStep Current time step.
+     */
+    virtual void giveRealStressesBatch(FloatMatrix &answer, const std::vector< GaussPoint * > &gps,
+                                       const FloatMatrix &reducedStrains, TimeStep *tStep);
+
     /**
      * Computes the First Piola-Kirchoff stress vector for a given deformation gradient and integration point.
      * The service should use previously reached equilibrium history variables. Also
@@ -120,6 +132,16 @@ public:
      * @param tStep Current time step (most models are able to respond only when tStep is current time step).
      */
     virtual void giveFirstPKStresses(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedFIncrement, TimeStep *tStep);
+    /**
+     * Batched counterpart of giveFirstPKStresses, see giveRealStressesBatch.
+     * The default implementation calls giveFirstPKStresses for each point.
+     * @param answer Stress vectors, one column per integration point.
+     * @param gps Integration points sharing the material mode.
+     * @param reducedFs Deformation gradients in reduced form, one column per integration point.
+     * @param tStep Current time step.
+     */
+    virtual void giveFirstPKStressesBatch(FloatMatrix &answer, const std::vector< GaussPoint * > &gps,
+                                          const FloatMatrix &reducedFs, TimeStep *tStep);
 
     /**
      * Computes the Cauchy stress vector for a given increment of deformation gradient and given integration point.
@@ -45,6 +45,8 @@
 #include "integrationdomain.h"
 #include "dofmantransftype.h"
 
+#include <vector>
+
 namespace oofem {
 #define ALL_STRAINS -1
 
@@ -97,6 +99,11 @@ class StructuralElement : public Element
 protected:
     /// Initial displacement vector, describes the initial nodal displacements when element has been casted.
     FloatArray *initialDisplacements;
+    /**
+     * Set to 1 by the generic computeStressVector, which evaluates the stresses by the cross section.
+     * Zero if an override of computeStressVector is used, -1 if not known yet. See computeStressVectorBatch.
+     */
+    int genericStressEvaluation;
 
 public:
     /**
@@ -237,6 +244,18 @@ public:
     virtual void giveInternalForcesVector_withIRulesAsSubcells(FloatArray &answer,
                                                                TimeStep *tStep, int useUpdatedGpRecord = 0);
 
+    /**
+     * Computes the internal forces vector and the stiffness matrix of the receiver for the same state.
+     * Used by engineering models when both quantities are needed in one iteration, so that elements
+     * can evaluate them in a single pass over integration points.
+     * Default implementation evaluates them separately using giveCharacteristicVector and giveCharacteristicMatrix.
+     * @param forces Internal nodal forces vector.
+     * @param tangent Stiffness matrix.
+     * @param mtrx Type of stiffness matrix (TangentStiffnessMatrix, SecantStiffnessMatrix, ...).
+     * @param tStep Time step.
+     */
+    virtual void computeInternalForcesAndTangent(FloatArray &forces, FloatMatrix &tangent, CharType mtrx, TimeStep *tStep);
+
     /**
      * Compute strain vector of receiver evaluated at given integration point at given time
      * step from element displacement vector.
@@ -558,6 +577,17 @@ protected:
      * @param tStep Time step.
      */
     virtual void computeStressVector(FloatArray &answer, const FloatArray &strain, GaussPoint *gp, TimeStep *tStep);
+    /**
+     * Computes the stress vectors of several integration points of the receiver at once.
+     * The whole batch is passed to the cross section, which allows the material model to vectorize its update,
+     * if the receiver evaluates the stresses by the generic computeStressVector. Otherwise (and in the first call,
+     * which determines it) computeStressVector is called for each point.
+     * @param answer Stress vectors, one column per integration point.
+     * @param gps Integration points.
+     * @param strains Strain vectors, one column per integration point.
+     * @param tStep Time step.
+     */
+    virtual void computeStressVectorBatch(FloatMatrix &answer, const std::vector< GaussPoint * > &gps, const FloatMatrix &strains, TimeStep *tStep);
 
     /**
      * Computes the geometrical matrix of receiver in given integration point.
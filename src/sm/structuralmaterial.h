@@ -42,6 +42,8 @@
 #include "matstatus.h"
 #include "stressstrainprincmode.h"
 
+#include <vector>
+
 ///@name Input fields for StructuralMaterial
 //@{
 #define _IFT_StructuralMaterial_referencetemperature "referencetemperature"
@@ -175,6 +177,19 @@ public:
     /// Default implementation relies on giveRealStressVector_StressControl
     virtual void giveRealStressVector_Fiber(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedE, TimeStep *tStep);
 
+    /**
+     * Computes the real stress vectors of several integration points at once.
+     * All points have to belong to the receiver and share the same material mode.
+     * Models with a cheap pointwise update can override this to process the points in tight loops,
+     * the default implementation calls the pointwise service of the corresponding mode for each point.
+     * @param answer Stress vectors in reduced form, one column per integration point.
+     * @param gps Integration points.
+     * @param reducedStrains Strain vectors in reduced form, one column per integration point.
+     * @param tStep Current time step.
+     */
+    virtual void giveRealStressVectorBatch(FloatMatrix &answer, const std::vector< GaussPoint * > &gps,
+                                           const FloatMatrix &reducedStrains, TimeStep *tStep);
+
     /**
      * @name Methods associated with the First PK stress tensor.
      * Computes the first Piola-Kirchhoff stress vector for given total deformation gradient and integration point.
@@ -201,6 +216,15 @@ public:
     virtual void giveFirstPKStressVector_PlaneStress(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedF, TimeStep *tStep);
     /// Default implementation relies on giveFirstPKStressVector_3d
     virtual void giveFirstPKStressVector_1d(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedF, TimeStep *tStep);
+    /**
+     * Batched counterpart of the first Piola-Kirchhoff stress services, see giveRealStressVectorBatch.
+     * @param answer Stress vectors in reduced form, one column per integration point.
+     * @param gps Integration points sharing the receiver and the material mode.
+     * @param reducedFs Deformation gradients in reduced form, one column per integration point.
+     * @param tStep Current time step.
+     */
+    virtual void giveFirstPKStressVectorBatch(FloatMatrix &answer, const std::vector< GaussPoint * > &gps,
+                                              const FloatMatrix &reducedFs, TimeStep *tStep);
     //@}
 
     /**
@@ -117,6 +117,9 @@ public:
     virtual int EIPrimaryFieldI_evaluateFieldVectorAt(FloatArray &answer, PrimaryField &pf,
                                                       FloatArray &coords, IntArray &dofId, ValueModeType mode,
                                                       TimeStep *atTime);
+    virtual int EIPrimaryFieldI_evaluateFieldVectorAtLocalCoords(FloatArray &answer, PrimaryField &pf,
+                                                                 const FloatArray &lcoords, IntArray &dofId, ValueModeType mode,
+                                                                 TimeStep *atTime);
 
 #ifdef __OOFEG
     int giveInternalStateAtNode(FloatArray &answer, InternalStateType type, InternalStateMode mode,
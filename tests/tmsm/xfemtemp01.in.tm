@@ -0,0 +1,32 @@
+xfemtemp01.out.tm
+Strip heated by a flux at its right edge, coarser mesh than in the mechanical problem
+NonStationaryProblem nsteps 4 deltat 1.0 alpha 0.5 lumpedcapa exportfields 1 5 nmodules 0
+domain heattransfer
+OutputManager tstep_all dofman_all element_all
+ndofman 10 nelem 4 ncrosssect 1 nmat 1 nbc 2 nic 1 nltf 1
+node 1 coords 3 0 0 0 ic 1 1 bc 1 2
+node 2 coords 3 1 0 0 ic 1 1
+node 3 coords 3 2 0 0 ic 1 1
+node 4 coords 3 3 0 0 ic 1 1
+node 5 coords 3 4 0 0 ic 1 1
+node 6 coords 3 0 1 0 ic 1 1 bc 1 2
+node 7 coords 3 1 1 0 ic 1 1
+node 8 coords 3 2 1 0 ic 1 1
+node 9 coords 3 3 1 0 ic 1 1
+node 10 coords 3 4 1 0 ic 1 1
+quad1ht 1 nodes 4 1 2 7 6 crosssect 1 mat 1
+quad1ht 2 nodes 4 2 3 8 7 crosssect 1 mat 1
+quad1ht 3 nodes 4 3 4 9 8 crosssect 1 mat 1
+quad1ht 4 nodes 4 4 5 10 9 crosssect 1 mat 1 boundaryLoads 2 1 2
+SimpleCS 1 thick 1.0
+IsoHeat 1 d 1.0 k 1.0 c 1.0
+constantedgeload 1 loadTimeFunction 1 ndofs 1 components 1 -10.0 loadtype 2
+BoundaryCondition 2 loadTimeFunction 1 prescribedvalue 0.0
+InitialCondition 1 Conditions 1 u 0.0
+ConstantFunction 1 f(t) 1.0
+#%BEGIN_CHECK% tolerance 1.e-6
+#NODE tStep 0.0 number 3 dof 1 unknown f value 8.24742268e-01
+#NODE tStep 0.0 number 5 dof 1 unknown f value 1.15463918e+01
+#NODE tStep 3.0 number 3 dof 1 unknown f value 7.38409521e+00
+#NODE tStep 3.0 number 5 dof 1 unknown f value 2.21306214e+01
+#%END_CHECK%